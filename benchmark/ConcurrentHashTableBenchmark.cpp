@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "hash_table/HashTable.h"
+#include "hash_table/ConcurrentHashTable.h"
+#include "hash_table/ShardedHashTable.h"
+#include "hash_table/LockFreeReadHashTable.h"
+
+/**
+ * Throughput benchmark of ConcurrentHashTable, ShardedHashTable and LockFreeReadHashTable against a HashTable guarded
+ * by a single mutex.
+ *
+ * Every thread runs the same number of operations on keys drawn from a prefilled key range:
+ * 90% ContainsKey, 10% Insert. The benchmark prints the number of operations per second for
+ * an increasing number of threads.
+ */
+namespace {
+    constexpr int kKeyRange = 1 << 20;
+    constexpr int kOperationsPerThread = 1 << 20;
+    constexpr int kReadPercent = 90;
+
+    class MutexHashTable {
+        HashTable<int, int> table;
+        std::mutex mutex;
+
+    public:
+        void Insert(const int key, const int value) {
+            std::lock_guard lock(mutex);
+            table.Insert(key, value);
+        }
+
+        bool ContainsKey(const int key) {
+            std::lock_guard lock(mutex);
+            return table.ContainsKey(key);
+        }
+    };
+
+    template<typename Table>
+    double Run(Table &table, const unsigned thread_count) {
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&table, t] {
+                std::mt19937 random(t + 1);
+                std::uniform_int_distribution<int> keys(0, kKeyRange - 1);
+                std::uniform_int_distribution<int> percent(0, 99);
+                uint64_t found = 0;
+                for (int i = 0; i < kOperationsPerThread; ++i) {
+                    const int key = keys(random);
+                    if (percent(random) < kReadPercent) {
+                        found += table.ContainsKey(key);
+                    } else {
+                        table.Insert(key, i);
+                    }
+                }
+                if (found == UINT64_MAX) {
+                    std::cout << found;
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(thread_count) * kOperationsPerThread / elapsed.count();
+    }
+
+    template<typename Table>
+    void Prefill(Table &table) {
+        for (int key = 0; key < kKeyRange; key += 2) {
+            table.Insert(key, key);
+        }
+    }
+}
+
+int main() {
+    const unsigned max_threads = std::max(1U, std::thread::hardware_concurrency());
+    std::cout << "threads\tmutex HashTable (Mops/s)\tConcurrentHashTable (Mops/s)\tShardedHashTable (Mops/s)"
+            << "\tLockFreeReadHashTable (Mops/s)" << std::endl;
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        MutexHashTable locked;
+        Prefill(locked);
+        ConcurrentHashTable<int, int> striped(kKeyRange, 0.75, 256);
+        Prefill(striped);
+        ShardedHashTable<int, int> sharded;
+        sharded.Reserve(kKeyRange);
+        Prefill(sharded);
+        LockFreeReadHashTable<int, int> lock_free(kKeyRange, 0.75, 256);
+        Prefill(lock_free);
+
+        const double locked_rate = Run(locked, threads);
+        const double striped_rate = Run(striped, threads);
+        const double sharded_rate = Run(sharded, threads);
+        const double lock_free_rate = Run(lock_free, threads);
+        std::cout << threads << "\t" << locked_rate / 1e6 << "\t" << striped_rate / 1e6 << "\t" << sharded_rate / 1e6
+                << "\t" << lock_free_rate / 1e6 << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,342 @@
+#ifndef CONCURRENTHASHTABLE_H
+#define CONCURRENTHASHTABLE_H
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <vector>
+#include "SeededHash.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" that is safe to use from several threads.
+ *
+ * The ConcurrentHashTable class uses the same chaining layout as HashTable. The buckets are split into stripes,
+ * and every stripe is guarded by its own reader/writer lock, so readers of any bucket and writers of different
+ * stripes run in parallel.
+ *
+ * Constructors:
+ *  - ConcurrentHashTable(size_t table_size = 64, float load_factor = 0.75, size_t stripe_count = 64): Initializes
+ *    a table. The number of buckets is rounded up to a multiple of the number of stripes.
+ *  - The table is neither copyable nor movable, because the locks are not.
+ *
+ * Destructor:
+ *  - ~ConcurrentHashTable(): Destroys the table and deallocates all nodes. Must not race with any other operation.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value): Inserts a key-value pair, overwriting the value of an existing key.
+ *  - Value Get(const Key &key) const: Returns a copy of the value of the key. Throws an exception if the key is not found.
+ *  - bool TryGet(const Key &key, Value &value) const: Copies the value of the key into value, returns false if not found.
+ *  - void Remove(const Key &key): Removes the key. Throws an exception if the key is not found.
+ *  - void Clear(): Removes all key-value pairs.
+ *  - bool ContainsKey(const Key &key) const: Returns true if the table contains the key.
+ *  - [[nodiscard]] bool IsEmpty() const: Returns true if the table is empty.
+ *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs.
+ *  - void Resize(): Doubles the number of buckets while holding every stripe exclusively.
+ *
+ * Time Complexity:
+ *  - Insert, Get, TryGet, Remove, ContainsKey: O(1) on average, O(n) in the worst case.
+ *  - Clear, Resize: O(n), and they block every other operation.
+ *  - IsEmpty, Size: O(1).
+ *
+ * Features:
+ * - The stripe of a key is hash % stripe_count, and the number of buckets is always a multiple of the number of
+ *   stripes. So the stripe of a key does not depend on the current number of buckets, and a bucket always belongs
+ *   to the same stripe: bucket i is guarded by stripe i % stripe_count.
+ * - Get and ContainsKey take the stripe lock in shared mode; Insert and Remove take it exclusively.
+ * - Resize locks every stripe in a fixed order, so it can not deadlock with another Resize or Clear.
+ * - Values are returned by copy, because a reference could be invalidated by another thread right after unlocking.
+ * - Every stripe lock sits on its own cache line, so taking one does not invalidate its neighbours.
+ * - The hash is a SeededHash with a random seed per table (see SeededHash.h), so the stripe and bucket of a key can
+ *   not be predicted from outside.
+ */
+template<typename Key, typename Value>
+class ConcurrentHashTable {
+    struct Node {
+        Key key;
+        Value value;
+        std::unique_ptr<Node> next;
+
+        Node(Key key, Value value, std::unique_ptr<Node> next)
+            : key(key), value(value), next(std::move(next)) {
+        }
+    };
+
+    struct alignas(64) Stripe {
+        mutable std::shared_mutex mutex;
+    };
+
+    std::vector<std::unique_ptr<Node> > buckets;
+    std::unique_ptr<Stripe[]> stripes;
+    size_t stripe_count;
+    std::atomic<size_t> table_size;
+    std::atomic<size_t> element_count;
+    float load_refactor;
+    SeededHash<Key> hasher;
+
+    [[nodiscard]] size_t Hash(const Key &key) const;
+
+    Stripe &StripeFor(size_t hash) const;
+
+    void LockAll() const;
+
+    void UnlockAll() const;
+
+    // Holds every stripe exclusively until it goes out of scope, also when the guarded code throws.
+    class AllStripesLock {
+        const ConcurrentHashTable &table;
+
+    public:
+        explicit AllStripesLock(const ConcurrentHashTable &table): table(table) {
+            table.LockAll();
+        }
+
+        AllStripesLock(const AllStripesLock &other) = delete;
+
+        AllStripesLock &operator=(const AllStripesLock &other) = delete;
+
+        ~AllStripesLock() {
+            table.UnlockAll();
+        }
+    };
+
+    void Rehash(size_t new_size);
+
+    void Grow();
+
+public:
+    // --- Constructors ---
+    explicit ConcurrentHashTable(size_t table_size = 64, float load_factor = 0.75, size_t stripe_count = 64);
+
+    ConcurrentHashTable(const ConcurrentHashTable &other) = delete;
+
+    ConcurrentHashTable(ConcurrentHashTable &&other) = delete;
+
+    // --- Overload operators ---
+    ConcurrentHashTable &operator=(const ConcurrentHashTable &other) = delete;
+
+    ConcurrentHashTable &operator=(ConcurrentHashTable &&other) = delete;
+
+    // --- Destructors ---
+    ~ConcurrentHashTable();
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    // --- Get element ---
+    Value Get(const Key &key) const;
+
+    bool TryGet(const Key &key, Value &value) const;
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key) const;
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    // --- Change size in hash table ---
+    void Resize();
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value>
+size_t ConcurrentHashTable<Key, Value>::Hash(const Key &key) const {
+    return hasher(key);
+}
+
+template<typename Key, typename Value>
+typename ConcurrentHashTable<Key, Value>::Stripe &ConcurrentHashTable<Key, Value>::StripeFor(const size_t hash) const {
+    return stripes[hash % stripe_count];
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::LockAll() const {
+    for (size_t i = 0; i < stripe_count; ++i) {
+        stripes[i].mutex.lock();
+    }
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::UnlockAll() const {
+    for (size_t i = stripe_count; i > 0; --i) {
+        stripes[i - 1].mutex.unlock();
+    }
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::Rehash(const size_t new_size) {
+    std::vector<std::unique_ptr<Node> > new_buckets(new_size);
+    for (auto &bucket: buckets) {
+        while (bucket) {
+            auto current = std::move(bucket);
+            bucket = std::move(current->next);
+            size_t new_index = Hash(current->key) % new_size;
+            current->next = std::move(new_buckets[new_index]);
+            new_buckets[new_index] = std::move(current);
+        }
+    }
+    buckets = std::move(new_buckets);
+    table_size.store(new_size, std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value>
+ConcurrentHashTable<Key, Value>::ConcurrentHashTable(size_t table_size, const float load_factor,
+                                                     const size_t stripe_count)
+    : stripes(new Stripe[stripe_count == 0 ? 1 : stripe_count]), stripe_count(stripe_count == 0 ? 1 : stripe_count),
+      table_size(0), element_count(0), load_refactor(load_factor) {
+    size_t size = (table_size + this->stripe_count - 1) / this->stripe_count * this->stripe_count;
+    size = size == 0 ? this->stripe_count : size;
+    buckets.resize(size);
+    this->table_size.store(size, std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value>
+ConcurrentHashTable<Key, Value>::~ConcurrentHashTable() {
+    for (auto &bucket: buckets) {
+        while (bucket) {
+            bucket = std::move(bucket->next);
+        }
+    }
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::Insert(const Key &key, const Value &value) {
+    const size_t hash = Hash(key);
+    {
+        std::unique_lock lock(StripeFor(hash).mutex);
+        auto &bucket = buckets[hash % table_size.load(std::memory_order_relaxed)];
+        for (Node *current = bucket.get(); current != nullptr; current = current->next.get()) {
+            if (current->key == key) {
+                current->value = value;
+                return;
+            }
+        }
+        bucket = std::make_unique<Node>(key, value, std::move(bucket));
+    }
+    const size_t count = element_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count >= table_size.load(std::memory_order_relaxed) * load_refactor) {
+        Grow();
+    }
+}
+
+template<typename Key, typename Value>
+Value ConcurrentHashTable<Key, Value>::Get(const Key &key) const {
+    Value value;
+    if (!TryGet(key, value)) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return value;
+}
+
+template<typename Key, typename Value>
+bool ConcurrentHashTable<Key, Value>::TryGet(const Key &key, Value &value) const {
+    const size_t hash = Hash(key);
+    std::shared_lock lock(StripeFor(hash).mutex);
+    const auto &bucket = buckets[hash % table_size.load(std::memory_order_relaxed)];
+    for (Node *current = bucket.get(); current != nullptr; current = current->next.get()) {
+        if (current->key == key) {
+            value = current->value;
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::Remove(const Key &key) {
+    const size_t hash = Hash(key);
+    std::unique_ptr<Node> removed;
+    {
+        std::unique_lock lock(StripeFor(hash).mutex);
+        std::unique_ptr<Node> *link = &buckets[hash % table_size.load(std::memory_order_relaxed)];
+        while (*link != nullptr && !((*link)->key == key)) {
+            link = &(*link)->next;
+        }
+        if (*link == nullptr) {
+            throw std::out_of_range("No such key exists!\n");
+        }
+        removed = std::move(*link);
+        *link = std::move(removed->next);
+    }
+    element_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::Clear() {
+    AllStripesLock lock(*this);
+    for (auto &bucket: buckets) {
+        while (bucket) {
+            bucket = std::move(bucket->next);
+        }
+    }
+    element_count.store(0, std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value>
+bool ConcurrentHashTable<Key, Value>::ContainsKey(const Key &key) const {
+    const size_t hash = Hash(key);
+    std::shared_lock lock(StripeFor(hash).mutex);
+    const auto &bucket = buckets[hash % table_size.load(std::memory_order_relaxed)];
+    for (Node *current = bucket.get(); current != nullptr; current = current->next.get()) {
+        if (current->key == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename Key, typename Value>
+bool ConcurrentHashTable<Key, Value>::IsEmpty() const {
+    return Size() == 0;
+}
+
+template<typename Key, typename Value>
+size_t ConcurrentHashTable<Key, Value>::Size() const {
+    return element_count.load(std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::Grow() {
+    AllStripesLock lock(*this);
+    // Several inserts can cross the threshold at once, only the first of them has to grow the table.
+    const size_t size = table_size.load(std::memory_order_relaxed);
+    if (element_count.load(std::memory_order_relaxed) >= size * load_refactor) {
+        Rehash(size * 2);
+    }
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::Resize() {
+    AllStripesLock lock(*this);
+    Rehash(table_size.load(std::memory_order_relaxed) * 2);
+}
+
+template<typename Key, typename Value>
+void ConcurrentHashTable<Key, Value>::Show() const {
+    for (size_t i = 0; i < stripe_count; ++i) {
+        stripes[i].mutex.lock_shared();
+    }
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        std::cout << "Bucket number: " << i << ": ";
+        for (Node *current = buckets[i].get(); current != nullptr; current = current->next.get()) {
+            std::cout << "[" << current->key << ", " << current->value << "] -> ";
+        }
+        std::cout << "nullptr" << std::endl;
+    }
+    for (size_t i = stripe_count; i > 0; --i) {
+        stripes[i - 1].mutex.unlock_shared();
+    }
+}
+
+
+#endif //CONCURRENTHASHTABLE_H
@@ -0,0 +1,640 @@
+#ifndef CUCKOOHASHTABLE_H
+#define CUCKOOHASHTABLE_H
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "HashMix.h"
+#include "SeededHash.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" with bucketized cuckoo hashing.
+ *
+ * The CuckooHashTable class provides the same surface as HashTable, but every key may only live in one of two
+ * buckets of four slots, or in a small stash. So a lookup never looks at more than two buckets and the stash,
+ * whatever keys were inserted before.
+ *
+ * Constructors:
+ *  - CuckooHashTable(size_t capacity = 16, float load_factor = 0.9, const Hash &hash = Hash(),
+ *    const KeyEqual &equal = KeyEqual()): Initializes an empty table with room for at least capacity pairs and the
+ *    given maximum load factor.
+ *  - CuckooHashTable(const CuckooHashTable &other): Copy constructor, creates a deep copy of another table.
+ *  - CuckooHashTable(CuckooHashTable &&other) noexcept: Move constructor, transfers ownership of the buckets.
+ *
+ * Destructor:
+ *  - ~CuckooHashTable(): Destroys all stored pairs and releases the buckets.
+ *
+ * Overloaded Operators:
+ *  - CuckooHashTable& operator=(const CuckooHashTable &other): Copy assignment operator.
+ *  - CuckooHashTable& operator=(CuckooHashTable &&other) noexcept: Move assignment operator.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value) / void Insert(Key &&key, Value &&value): Inserts a key-value pair,
+ *    overwriting the value of an existing key.
+ *  - Value &Get(const Key &key): Retrieves the value associated with the key. Throws an exception if the key is not found.
+ *  - Value *Find(const Key &key): Returns a pointer to the value associated with the key, or nullptr.
+ *  - void Remove(const Key &key): Removes the key. Throws an exception if the key is not found.
+ *  - void Clear(): Removes all key-value pairs, keeping the buckets.
+ *  - bool ContainsKey(const Key &key): Returns true if the table contains the key, false otherwise.
+ *  - [[nodiscard]] bool IsEmpty() const: Returns true if the table is empty.
+ *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs in the table.
+ *  - [[nodiscard]] size_t BucketCount() const / size_t Capacity() const: Number of buckets and of bucket slots.
+ *  - [[nodiscard]] size_t StashSize() const: Returns the number of pairs kept in the stash.
+ *  - void Reserve(size_t count): Grows the table at once to hold count pairs below the maximum load factor.
+ *  - void Resize(): Doubles the number of buckets and reinserts every pair.
+ *  - void Show() const: Prints the buckets and the stash.
+ *
+ * Private Methods:
+ *  - size_t HashOf(const Key &key) const, static uint8_t TagOf(size_t hash): Mixed hash and its nonzero 8 bit tag.
+ *  - size_t AltIndex(size_t index, uint8_t tag) const: The other bucket of a key, computed from one bucket and the tag,
+ *    so a displaced pair finds its alternative bucket without hashing its key again.
+ *  - Slot *FindSlot(const Key &key, size_t hash): Looks in both buckets and the stash.
+ *  - size_t MakeRoom(size_t first, size_t second): Breadth-first search for the shortest chain of displacements that
+ *    frees a slot in one of the two buckets; performs it and returns that bucket.
+ *  - bool Place(Slot &&slot): Stores a new pair in a bucket or in the stash. Returns false if both are full.
+ *  - void Rehash(size_t new_bucket_count): Moves every pair into a new bucket array, growing it further if needed.
+ *
+ * Time Complexity:
+ *  - Get, Find, ContainsKey: O(1) in the worst case - two buckets of four slots and a stash of at most kStashSize pairs.
+ *  - Remove: O(1) in the worst case.
+ *  - Insert: O(1) on average; a displacement search visits at most kMaxSearch buckets before the stash is used.
+ *  - Clear, Reserve, Resize: O(n + bucket_count).
+ *
+ * Features:
+ * - A bucket holds the 8 bit tags of its slots in front of the pairs, so a lookup only compares the keys whose tag
+ *   matches. For pairs of up to 15 bytes a bucket is aligned to and fits in one 64 byte cache line.
+ * - The breadth-first search moves as few pairs as possible, and the pairs that can not be placed within kMaxSearch
+ *   buckets go to the stash. Only a full stash makes Insert grow the table. Remove moves a stashed pair back into
+ *   the bucket it frees when it can.
+ * - Two-choice bucketized hashing keeps working up to a load of about 95%, so the default load factor is 0.9.
+ * - Hash defaults to SeededHash (see SeededHash.h). With a predictable hash, keys chosen to share their two buckets
+ *   would fill the stash and force a resize on every insert.
+ */
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key> >
+class CuckooHashTable {
+    struct Slot {
+        Key key;
+        Value value;
+
+        template<typename K, typename V>
+        Slot(K &&key, V &&value) : key(std::forward<K>(key)), value(std::forward<V>(value)) {
+        }
+    };
+
+    static constexpr size_t kSlotsPerBucket = 4;
+    // Pairs that find no place after the displacement search; a full stash makes Insert grow the table.
+    static constexpr size_t kStashSize = 8;
+    // Number of buckets the displacement search may visit.
+    static constexpr size_t kMaxSearch = 256;
+    static constexpr size_t kNone = static_cast<size_t>(-1);
+    static constexpr size_t kBucketAlign =
+            kSlotsPerBucket * sizeof(Slot) + alignof(Slot) <= 64 ? 64 : alignof(Slot);
+
+    struct alignas(kBucketAlign) Bucket {
+        // Tag of the key in every slot, 0 for an empty slot.
+        uint8_t tags[kSlotsPerBucket];
+        alignas(Slot) unsigned char storage[kSlotsPerBucket][sizeof(Slot)];
+
+        Slot &At(const size_t index) {
+            return *std::launder(reinterpret_cast<Slot *>(storage[index]));
+        }
+
+        const Slot &At(const size_t index) const {
+            return *std::launder(reinterpret_cast<const Slot *>(storage[index]));
+        }
+
+        [[nodiscard]] size_t FreeSlot() const {
+            for (size_t i = 0; i < kSlotsPerBucket; ++i) {
+                if (tags[i] == 0) {
+                    return i;
+                }
+            }
+            return kNone;
+        }
+    };
+
+    Bucket *buckets;
+    size_t bucket_count;
+    size_t element_count;
+    float load_refactor;
+    std::vector<Slot> stash;
+    Hash hasher;
+    KeyEqual key_equal;
+
+    [[nodiscard]] size_t HashOf(const Key &key) const;
+
+    static uint8_t TagOf(size_t hash);
+
+    [[nodiscard]] size_t AltIndex(size_t index, uint8_t tag) const;
+
+    static size_t BucketCountFor(size_t count, float load_factor);
+
+    void Allocate(size_t new_bucket_count);
+
+    void Deallocate();
+
+    void DestroySlots();
+
+    void DrainInto(std::vector<Slot> &entries);
+
+    Slot *FindSlot(const Key &key, size_t hash);
+
+    size_t MakeRoom(size_t first, size_t second);
+
+    bool Place(Slot &&slot);
+
+    void Rehash(size_t new_bucket_count);
+
+    void CopyFrom(const CuckooHashTable &other);
+
+    template<typename K, typename V>
+    void InsertImpl(K &&key, V &&value);
+
+public:
+    // --- Constructors ---
+    explicit CuckooHashTable(size_t capacity = 16, float load_factor = 0.9, const Hash &hash = Hash(),
+                             const KeyEqual &equal = KeyEqual());
+
+    CuckooHashTable(const CuckooHashTable &other);
+
+    CuckooHashTable(CuckooHashTable &&other) noexcept;
+
+    // --- Overload operators ---
+    CuckooHashTable &operator=(const CuckooHashTable &other);
+
+    CuckooHashTable &operator=(CuckooHashTable &&other) noexcept;
+
+    // --- Destructors ---
+    ~CuckooHashTable();
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    void Insert(Key &&key, Value &&value);
+
+    // --- Get element ---
+    Value &Get(const Key &key);
+
+    Value *Find(const Key &key);
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key);
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t BucketCount() const;
+
+    [[nodiscard]] size_t Capacity() const;
+
+    [[nodiscard]] size_t StashSize() const;
+
+    // --- Change size in hash table ---
+    void Reserve(size_t count);
+
+    void Resize();
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t CuckooHashTable<Key, Value, Hash, KeyEqual>::HashOf(const Key &key) const {
+    return MixHash(hasher(key));
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+uint8_t CuckooHashTable<Key, Value, Hash, KeyEqual>::TagOf(const size_t hash) {
+    const auto tag = static_cast<uint8_t>(hash >> (sizeof(size_t) * 8 - 8));
+    return tag == 0 ? 1 : tag;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t CuckooHashTable<Key, Value, Hash, KeyEqual>::AltIndex(const size_t index, const uint8_t tag) const {
+    // XOR with a function of the tag only: applying it twice gives the first bucket back.
+    return (index ^ MixHash(tag)) & (bucket_count - 1);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t CuckooHashTable<Key, Value, Hash, KeyEqual>::BucketCountFor(const size_t count, const float load_factor) {
+    size_t result = 2;
+    while (static_cast<double>(result * kSlotsPerBucket) * load_factor < static_cast<double>(count)) {
+        result *= 2;
+    }
+    return result;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Allocate(const size_t new_bucket_count) {
+    buckets = new Bucket[new_bucket_count]();
+    bucket_count = new_bucket_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Deallocate() {
+    delete[] buckets;
+    buckets = nullptr;
+    bucket_count = 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::DestroySlots() {
+    for (size_t b = 0; b < bucket_count; ++b) {
+        for (size_t i = 0; i < kSlotsPerBucket; ++i) {
+            if (buckets[b].tags[i] != 0) {
+                buckets[b].At(i).~Slot();
+                buckets[b].tags[i] = 0;
+            }
+        }
+    }
+    stash.clear();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::DrainInto(std::vector<Slot> &entries) {
+    for (size_t b = 0; b < bucket_count; ++b) {
+        for (size_t i = 0; i < kSlotsPerBucket; ++i) {
+            if (buckets[b].tags[i] != 0) {
+                entries.push_back(std::move(buckets[b].At(i)));
+                buckets[b].At(i).~Slot();
+                buckets[b].tags[i] = 0;
+            }
+        }
+    }
+    for (Slot &slot: stash) {
+        entries.push_back(std::move(slot));
+    }
+    stash.clear();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename CuckooHashTable<Key, Value, Hash, KeyEqual>::Slot *
+CuckooHashTable<Key, Value, Hash, KeyEqual>::FindSlot(const Key &key, const size_t hash) {
+    const uint8_t tag = TagOf(hash);
+    const size_t first = hash & (bucket_count - 1);
+    for (const size_t index: {first, AltIndex(first, tag)}) {
+        Bucket &bucket = buckets[index];
+        for (size_t i = 0; i < kSlotsPerBucket; ++i) {
+            if (bucket.tags[i] == tag && key_equal(bucket.At(i).key, key)) {
+                return &bucket.At(i);
+            }
+        }
+    }
+    for (Slot &slot: stash) {
+        if (key_equal(slot.key, key)) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t CuckooHashTable<Key, Value, Hash, KeyEqual>::MakeRoom(const size_t first, const size_t second) {
+    struct Step {
+        size_t bucket;
+        // Index of the step whose bucket holds the pair that moves into this bucket, kNone for the two roots.
+        size_t parent;
+        size_t slot;
+    };
+    Step steps[kMaxSearch];
+    size_t head = 0;
+    size_t tail = 0;
+    steps[tail++] = {first, kNone, 0};
+    if (second != first) {
+        steps[tail++] = {second, kNone, 0};
+    }
+    while (head < tail) {
+        const size_t current = head++;
+        if (buckets[steps[current].bucket].FreeSlot() == kNone) {
+            for (size_t i = 0; i < kSlotsPerBucket && tail < kMaxSearch; ++i) {
+                const size_t bucket = steps[current].bucket;
+                steps[tail++] = {AltIndex(bucket, buckets[bucket].tags[i]), current, i};
+            }
+            continue;
+        }
+        // Walk the path back to its root, moving every pair one step forward into the slot freed before it.
+        size_t step = current;
+        while (steps[step].parent != kNone) {
+            const Step &to = steps[step];
+            const size_t from_index = steps[to.parent].bucket;
+            Bucket &from = buckets[from_index];
+            const uint8_t tag = from.tags[to.slot];
+            const size_t free_slot = buckets[to.bucket].FreeSlot();
+            // A bucket that shows up twice on the path may have changed since the search; give up on the path.
+            if (tag == 0 || AltIndex(from_index, tag) != to.bucket || free_slot == kNone) {
+                return kNone;
+            }
+            new(buckets[to.bucket].storage[free_slot]) Slot(std::move(from.At(to.slot)));
+            buckets[to.bucket].tags[free_slot] = tag;
+            from.At(to.slot).~Slot();
+            from.tags[to.slot] = 0;
+            step = to.parent;
+        }
+        return steps[step].bucket;
+    }
+    return kNone;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool CuckooHashTable<Key, Value, Hash, KeyEqual>::Place(Slot &&slot) {
+    const size_t hash = HashOf(slot.key);
+    const uint8_t tag = TagOf(hash);
+    const size_t first = hash & (bucket_count - 1);
+    const size_t second = AltIndex(first, tag);
+    size_t index = first;
+    size_t free_slot = buckets[first].FreeSlot();
+    if (free_slot == kNone) {
+        index = second;
+        free_slot = buckets[second].FreeSlot();
+    }
+    if (free_slot == kNone) {
+        index = MakeRoom(first, second);
+        free_slot = index == kNone ? kNone : buckets[index].FreeSlot();
+    }
+    if (free_slot != kNone) {
+        new(buckets[index].storage[free_slot]) Slot(std::move(slot));
+        buckets[index].tags[free_slot] = tag;
+        return true;
+    }
+    if (stash.size() < kStashSize) {
+        stash.push_back(std::move(slot));
+        return true;
+    }
+    return false;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Rehash(size_t new_bucket_count) {
+    std::vector<Slot> entries;
+    entries.reserve(element_count);
+    DrainInto(entries);
+    Deallocate();
+    while (true) {
+        Allocate(new_bucket_count);
+        size_t placed = 0;
+        while (placed < entries.size() && Place(std::move(entries[placed]))) {
+            ++placed;
+        }
+        if (placed == entries.size()) {
+            return;
+        }
+        // Too many pairs collide even in the new array: take them all back and try twice as many buckets.
+        std::vector<Slot> retry;
+        retry.reserve(entries.size());
+        DrainInto(retry);
+        for (size_t i = placed; i < entries.size(); ++i) {
+            retry.push_back(std::move(entries[i]));
+        }
+        entries = std::move(retry);
+        Deallocate();
+        new_bucket_count *= 2;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::CopyFrom(const CuckooHashTable &other) {
+    Allocate(other.bucket_count);
+    for (size_t b = 0; b < bucket_count; ++b) {
+        for (size_t i = 0; i < kSlotsPerBucket; ++i) {
+            if (other.buckets[b].tags[i] != 0) {
+                new(buckets[b].storage[i]) Slot(other.buckets[b].At(i));
+                buckets[b].tags[i] = other.buckets[b].tags[i];
+            }
+        }
+    }
+    stash = other.stash;
+    element_count = other.element_count;
+    load_refactor = other.load_refactor;
+    hasher = other.hasher;
+    key_equal = other.key_equal;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K, typename V>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::InsertImpl(K &&key, V &&value) {
+    // A moved-from table has no buckets yet.
+    if (bucket_count == 0) {
+        Resize();
+    }
+    if (Slot *slot = FindSlot(key, HashOf(key)); slot != nullptr) {
+        slot->value = std::forward<V>(value);
+        return;
+    }
+    if (element_count + 1 > Capacity() * load_refactor) {
+        Resize();
+    }
+    Slot slot(std::forward<K>(key), std::forward<V>(value));
+    while (!Place(std::move(slot))) {
+        Resize();
+    }
+    ++element_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+CuckooHashTable<Key, Value, Hash, KeyEqual>::CuckooHashTable(const size_t capacity, const float load_factor,
+                                                             const Hash &hash, const KeyEqual &equal)
+    : buckets(nullptr), bucket_count(0), element_count(0), load_refactor(load_factor), hasher(hash),
+      key_equal(equal) {
+    Allocate(BucketCountFor(capacity, load_factor));
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+CuckooHashTable<Key, Value, Hash, KeyEqual>::CuckooHashTable(const CuckooHashTable &other)
+    : buckets(nullptr), bucket_count(0), element_count(0), load_refactor(other.load_refactor) {
+    CopyFrom(other);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+CuckooHashTable<Key, Value, Hash, KeyEqual>::CuckooHashTable(CuckooHashTable &&other) noexcept
+    : buckets(other.buckets), bucket_count(other.bucket_count), element_count(other.element_count),
+      load_refactor(other.load_refactor), stash(std::move(other.stash)), hasher(std::move(other.hasher)),
+      key_equal(std::move(other.key_equal)) {
+    other.buckets = nullptr;
+    other.bucket_count = 0;
+    other.element_count = 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+CuckooHashTable<Key, Value, Hash, KeyEqual> &
+CuckooHashTable<Key, Value, Hash, KeyEqual>::operator=(const CuckooHashTable &other) {
+    if (this != &other) {
+        DestroySlots();
+        Deallocate();
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+CuckooHashTable<Key, Value, Hash, KeyEqual> &
+CuckooHashTable<Key, Value, Hash, KeyEqual>::operator=(CuckooHashTable &&other) noexcept {
+    if (this != &other) {
+        DestroySlots();
+        Deallocate();
+        buckets = other.buckets;
+        bucket_count = other.bucket_count;
+        element_count = other.element_count;
+        load_refactor = other.load_refactor;
+        stash = std::move(other.stash);
+        hasher = std::move(other.hasher);
+        key_equal = std::move(other.key_equal);
+
+        other.buckets = nullptr;
+        other.bucket_count = 0;
+        other.element_count = 0;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+CuckooHashTable<Key, Value, Hash, KeyEqual>::~CuckooHashTable() {
+    DestroySlots();
+    Deallocate();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Insert(const Key &key, const Value &value) {
+    InsertImpl(key, value);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Insert(Key &&key, Value &&value) {
+    InsertImpl(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+Value &CuckooHashTable<Key, Value, Hash, KeyEqual>::Get(const Key &key) {
+    Value *value = Find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+Value *CuckooHashTable<Key, Value, Hash, KeyEqual>::Find(const Key &key) {
+    if (bucket_count == 0) {
+        return nullptr;
+    }
+    Slot *slot = FindSlot(key, HashOf(key));
+    return slot == nullptr ? nullptr : &slot->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Remove(const Key &key) {
+    if (bucket_count != 0) {
+        const size_t hash = HashOf(key);
+        const uint8_t tag = TagOf(hash);
+        const size_t first = hash & (bucket_count - 1);
+        for (const size_t index: {first, AltIndex(first, tag)}) {
+            Bucket &bucket = buckets[index];
+            for (size_t i = 0; i < kSlotsPerBucket; ++i) {
+                if (bucket.tags[i] != tag || !key_equal(bucket.At(i).key, key)) {
+                    continue;
+                }
+                bucket.At(i).~Slot();
+                bucket.tags[i] = 0;
+                --element_count;
+                // Give the freed slot to a stashed pair that belongs to this bucket.
+                for (auto it = stash.begin(); it != stash.end(); ++it) {
+                    const size_t stashed_hash = HashOf(it->key);
+                    const size_t stashed_first = stashed_hash & (bucket_count - 1);
+                    if (stashed_first == index || AltIndex(stashed_first, TagOf(stashed_hash)) == index) {
+                        new(bucket.storage[i]) Slot(std::move(*it));
+                        bucket.tags[i] = TagOf(stashed_hash);
+                        stash.erase(it);
+                        break;
+                    }
+                }
+                return;
+            }
+        }
+        for (auto it = stash.begin(); it != stash.end(); ++it) {
+            if (key_equal(it->key, key)) {
+                stash.erase(it);
+                --element_count;
+                return;
+            }
+        }
+    }
+    throw std::out_of_range("No such key exists!\n");
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Clear() {
+    DestroySlots();
+    element_count = 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool CuckooHashTable<Key, Value, Hash, KeyEqual>::ContainsKey(const Key &key) {
+    return Find(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool CuckooHashTable<Key, Value, Hash, KeyEqual>::IsEmpty() const {
+    return element_count == 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t CuckooHashTable<Key, Value, Hash, KeyEqual>::Size() const {
+    return element_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t CuckooHashTable<Key, Value, Hash, KeyEqual>::BucketCount() const {
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t CuckooHashTable<Key, Value, Hash, KeyEqual>::Capacity() const {
+    return bucket_count * kSlotsPerBucket;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t CuckooHashTable<Key, Value, Hash, KeyEqual>::StashSize() const {
+    return stash.size();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Reserve(const size_t count) {
+    const size_t new_bucket_count = BucketCountFor(count, load_refactor);
+    if (new_bucket_count > bucket_count) {
+        Rehash(new_bucket_count);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Resize() {
+    Rehash(bucket_count == 0 ? 2 : bucket_count * 2);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void CuckooHashTable<Key, Value, Hash, KeyEqual>::Show() const {
+    for (size_t b = 0; b < bucket_count; ++b) {
+        std::cout << "Bucket number: " << b << ":";
+        for (size_t i = 0; i < kSlotsPerBucket; ++i) {
+            if (buckets[b].tags[i] != 0) {
+                std::cout << " [" << buckets[b].At(i).key << ", " << buckets[b].At(i).value << "]";
+            }
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "Stash:";
+    for (const Slot &slot: stash) {
+        std::cout << " [" << slot.key << ", " << slot.value << "]";
+    }
+    std::cout << std::endl;
+}
+
+
+#endif //CUCKOOHASHTABLE_H
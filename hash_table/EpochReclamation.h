@@ -0,0 +1,234 @@
+#ifndef EPOCHRECLAMATION_H
+#define EPOCHRECLAMATION_H
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+/**
+ * Epoch-based reclamation of memory shared with lock-free readers.
+ *
+ * A reader pins the current global epoch for the duration of an EpochGuard. A writer that unlinks an object hands
+ * it to Retire instead of deleting it; the object is deleted once the global epoch has advanced twice since then,
+ * because by that time every reader that could still hold a pointer to it has left its guard.
+ *
+ * Public Methods:
+ *  - static EpochDomain &Instance(): Returns the process-wide domain shared by all containers.
+ *  - void Retire(T *object): Deletes the object once no reader can reach it any more.
+ *  - void Collect(): Tries to advance the epoch and deletes whatever has become safe to delete.
+ *  - [[nodiscard]] size_t Pending() const: Returns the number of retired objects that are not deleted yet.
+ *
+ * Private Methods:
+ *  - Slot &ThreadSlot(): Returns the slot of the calling thread, claiming one on its first call.
+ *  - void Enter() / void Leave(): Pin and unpin the epoch of the calling thread. Only EpochGuard calls them.
+ *  - bool TryAdvance(): Advances the global epoch if every pinned thread has seen the current one.
+ *
+ * Time Complexity:
+ *  - Enter, Leave: O(1), plain loads and stores plus one fence, no read-modify-write and no lock.
+ *  - Retire: O(1) amortized; every kCollectBatch retires it runs Collect, which is O(kMaxThreads + pending).
+ *
+ * Features:
+ * - Every thread slot sits on its own cache line, so pinning never invalidates the line of another reader.
+ * - Guards nest: only the outermost guard of a thread pins and unpins the epoch.
+ * - A slot is claimed on the first guard of a thread and given back when the thread exits. At most kMaxThreads
+ *   threads may use the domain at the same time.
+ */
+class EpochDomain {
+    static constexpr size_t kMaxThreads = 256;
+    static constexpr size_t kCollectBatch = 64;
+
+    struct alignas(64) Slot {
+        // 0 while the thread is outside of any guard, the pinned epoch otherwise.
+        std::atomic<uint64_t> epoch{0};
+        std::atomic<bool> claimed{false};
+    };
+
+    struct ThreadRecord {
+        Slot *slot = nullptr;
+        unsigned depth = 0;
+
+        ~ThreadRecord() {
+            if (slot != nullptr) {
+                slot->claimed.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    struct Retired {
+        void *object;
+        void (*destroy)(void *);
+        uint64_t epoch;
+    };
+
+    std::atomic<uint64_t> global_epoch{1};
+    Slot slots[kMaxThreads];
+    mutable std::mutex retired_mutex;
+    std::vector<Retired> retired;
+    size_t retired_since_collect = 0;
+
+    EpochDomain() = default;
+
+    ~EpochDomain();
+
+    static ThreadRecord &Record();
+
+    Slot &ThreadSlot();
+
+    void Enter();
+
+    void Leave();
+
+    bool TryAdvance();
+
+    void CollectLocked();
+
+    template<typename T>
+    static void Destroy(void *object);
+
+    friend class EpochGuard;
+
+public:
+    EpochDomain(const EpochDomain &other) = delete;
+
+    EpochDomain &operator=(const EpochDomain &other) = delete;
+
+    static EpochDomain &Instance();
+
+    template<typename T>
+    void Retire(T *object);
+
+    void Collect();
+
+    [[nodiscard]] size_t Pending() const;
+};
+
+/*
+ * RAII guard of a read-side critical section: objects reachable when it was created stay alive until it is destroyed.
+ */
+class EpochGuard {
+public:
+    EpochGuard() {
+        EpochDomain::Instance().Enter();
+    }
+
+    ~EpochGuard() {
+        EpochDomain::Instance().Leave();
+    }
+
+    EpochGuard(const EpochGuard &other) = delete;
+
+    EpochGuard &operator=(const EpochGuard &other) = delete;
+};
+
+inline EpochDomain::~EpochDomain() {
+    for (const Retired &entry: retired) {
+        entry.destroy(entry.object);
+    }
+}
+
+inline EpochDomain &EpochDomain::Instance() {
+    static EpochDomain domain;
+    return domain;
+}
+
+inline EpochDomain::ThreadRecord &EpochDomain::Record() {
+    thread_local ThreadRecord record;
+    return record;
+}
+
+inline EpochDomain::Slot &EpochDomain::ThreadSlot() {
+    ThreadRecord &record = Record();
+    if (record.slot == nullptr) {
+        for (Slot &slot: slots) {
+            bool expected = false;
+            if (!slot.claimed.load(std::memory_order_relaxed) &&
+                slot.claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                record.slot = &slot;
+                break;
+            }
+        }
+        if (record.slot == nullptr) {
+            throw std::runtime_error("Too many threads use the epoch domain!\n");
+        }
+    }
+    return *record.slot;
+}
+
+inline void EpochDomain::Enter() {
+    ThreadRecord &record = Record();
+    if (record.depth++ != 0) {
+        return;
+    }
+    Slot &slot = ThreadSlot();
+    // Re-read the epoch after publishing it: if it moved in between, a writer may have missed the pin.
+    uint64_t epoch = global_epoch.load(std::memory_order_relaxed);
+    while (true) {
+        slot.epoch.store(epoch, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const uint64_t current = global_epoch.load(std::memory_order_relaxed);
+        if (current == epoch) {
+            break;
+        }
+        epoch = current;
+    }
+}
+
+inline void EpochDomain::Leave() {
+    ThreadRecord &record = Record();
+    if (--record.depth == 0) {
+        record.slot->epoch.store(0, std::memory_order_release);
+    }
+}
+
+inline bool EpochDomain::TryAdvance() {
+    uint64_t epoch = global_epoch.load(std::memory_order_seq_cst);
+    for (const Slot &slot: slots) {
+        const uint64_t pinned = slot.epoch.load(std::memory_order_seq_cst);
+        if (pinned != 0 && pinned != epoch) {
+            return false;
+        }
+    }
+    return global_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+inline void EpochDomain::CollectLocked() {
+    TryAdvance();
+    const uint64_t epoch = global_epoch.load(std::memory_order_seq_cst);
+    size_t kept = 0;
+    for (const Retired &entry: retired) {
+        if (entry.epoch + 2 <= epoch) {
+            entry.destroy(entry.object);
+        } else {
+            retired[kept++] = entry;
+        }
+    }
+    retired.resize(kept);
+    retired_since_collect = 0;
+}
+
+template<typename T>
+void EpochDomain::Destroy(void *object) {
+    delete static_cast<T *>(object);
+}
+
+template<typename T>
+void EpochDomain::Retire(T *object) {
+    std::lock_guard lock(retired_mutex);
+    retired.push_back({object, &Destroy<T>, global_epoch.load(std::memory_order_seq_cst)});
+    if (++retired_since_collect >= kCollectBatch) {
+        CollectLocked();
+    }
+}
+
+inline void EpochDomain::Collect() {
+    std::lock_guard lock(retired_mutex);
+    CollectLocked();
+}
+
+inline size_t EpochDomain::Pending() const {
+    std::lock_guard lock(retired_mutex);
+    return retired.size();
+}
+
+
+#endif //EPOCHRECLAMATION_H
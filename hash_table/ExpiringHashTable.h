@@ -0,0 +1,582 @@
+#ifndef EXPIRINGHASHTABLE_H
+#define EXPIRINGHASHTABLE_H
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "HashTable.h"
+#include "NodePool.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" whose entries expire.
+ *
+ * The ExpiringHashTable class stores every key-value pair with a time to live. The pairs are found through a HashTable
+ * and are also kept in a hierarchical timing wheel ordered by their deadlines, so the expired pairs can be reclaimed
+ * without looking at the ones that are still alive.
+ *
+ * Constructors:
+ *  - ExpiringHashTable(Duration default_ttl, Duration resolution = std::chrono::milliseconds(1), const Hash &hash = Hash(),
+ *    const KeyEqual &equal = KeyEqual()): Initializes an empty table. Insert without a ttl uses default_ttl; the
+ *    deadlines are rounded up to whole ticks of the given resolution.
+ *  - ExpiringHashTable(ExpiringHashTable &&other) noexcept: Move constructor, transfers ownership of the entries.
+ *  - The table is not copyable: the expiration callback may own resources tied to the entries.
+ *
+ * Destructor:
+ *  - ~ExpiringHashTable(): Destroys all entries without calling the expiration callback.
+ *
+ * Overloaded Operators:
+ *  - ExpiringHashTable& operator=(ExpiringHashTable &&other) noexcept: Move assignment operator.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value) / void Insert(Key &&key, Value &&value): Inserts or overwrites the
+ *    pair with the default time to live.
+ *  - void Insert(key, value, Duration ttl): Same, with a time to live of its own. An overwrite restarts the ttl.
+ *  - Value *Find(const Key &key): Returns a pointer to the value, or nullptr if the key is missing or expired. An expired
+ *    pair found here is reclaimed at once (lazy expiry).
+ *  - Value &Get(const Key &key): Same as Find, but throws an exception if the key is missing or expired.
+ *  - bool ContainsKey(const Key &key): Returns true if the key is present and not expired.
+ *  - bool Refresh(const Key &key, Duration ttl): Gives a live pair a new time to live. Returns false if it is missing
+ *    or expired.
+ *  - void Remove(const Key &key): Removes the pair without calling the expiration callback. Throws if it is missing.
+ *  - size_t Expire() / size_t ExpireUntil(TimePoint now): Advances the timing wheel to now and reclaims every pair
+ *    whose deadline has passed. Returns the number of reclaimed pairs.
+ *  - void Clear(): Removes all pairs without calling the expiration callback.
+ *  - void SetExpirationCallback(ExpirationCallback callback): Sets the function called with every expired pair.
+ *  - [[nodiscard]] bool IsEmpty() const, [[nodiscard]] size_t Size() const: Number of pairs, including the expired pairs
+ *    that were not reclaimed yet.
+ *  - void Show() const: Prints the pairs with their deadlines in ticks.
+ *
+ * Private Methods:
+ *  - uint64_t TickOf(TimePoint time, bool round_up) const / uint64_t TicksOf(Duration ttl) const: Convert times and
+ *    durations to ticks of the resolution since the construction of the table.
+ *  - void Place(Node *node) / void Unlink(Node *node): Put a pair into the wheel slot of its deadline, or take it out.
+ *  - void Cascade(size_t level, size_t slot): Moves the pairs of a slot of a coarse level down to finer levels.
+ *  - uint64_t NextEventTick(uint64_t target) const: The next tick that has a slot to cascade or to expire, at most
+ *    target.
+ *  - static unsigned TrailingZeros(uint64_t mask): Index of the lowest set bit of a non-zero occupancy mask.
+ *  - Node *FindNode(const Key &key): Returns the node of a live key, or nullptr. A key that is found expired is
+ *    reclaimed on the spot. Find and Refresh are built on it.
+ *  - void ExpireNode(Node *node): Reclaims an expired pair and calls the expiration callback.
+ *  - size_t ExpireSlot(size_t slot): Reclaims all pairs of a slot of level 0.
+ *  - void InsertImpl(K &&key, V &&value, Duration ttl): Shared body of the Insert overloads.
+ *
+ * Time Complexity:
+ *  - Insert, Find, Get, ContainsKey, Refresh, Remove: O(1) on average.
+ *  - Expire: O(expired + cascaded pairs + kLevels) per slot with work, independent of the number of live pairs and of
+ *    the time that passed. A pair is cascaded at most kLevels - 1 times over its life.
+ *  - Clear: O(n).
+ *
+ * Features:
+ * - The wheel has kLevels levels of kSlots slots: level 0 holds the pairs due within kSlots ticks with one slot per
+ *   tick, and each higher level covers kSlots times the range of the level below. When the time reaches a slot of a
+ *   higher level, its pairs move down to the level their remaining time fits in. Pairs beyond the last level wait
+ *   in its farthest slot and are placed again when it is reached.
+ * - Every level keeps a bit mask of its non-empty slots, so Expire jumps straight to the next tick with work instead
+ *   of stepping through the ticks of a long idle time.
+ * - Nothing runs in the background: Find and Get never return an expired value, and Expire (called e.g. from the
+ *   thread that owns the table, as often as is convenient) frees the memory of the expired pairs.
+ */
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key>,
+    typename Clock = std::chrono::steady_clock>
+class ExpiringHashTable {
+public:
+    using Duration = typename Clock::duration;
+    using TimePoint = typename Clock::time_point;
+    using ExpirationCallback = std::function<void(const Key &, Value &)>;
+
+private:
+    static constexpr size_t kLevels = 4;
+    static constexpr size_t kSlotBits = 6;
+    static constexpr size_t kSlots = size_t{1} << kSlotBits;
+    // Deadlines are capped so that adding a time to live never overflows.
+    static constexpr uint64_t kMaxTicks = UINT64_MAX / 4;
+
+    struct Node {
+        Key key;
+        Value value;
+        uint64_t deadline;
+        Node *previous = nullptr;
+        Node *next = nullptr;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+
+        template<typename K, typename V>
+        Node(K &&key, V &&value, uint64_t deadline): key(std::forward<K>(key)), value(std::forward<V>(value)),
+                                                     deadline(deadline) {
+        }
+    };
+
+    HashTable<Key, Node *, Hash, KeyEqual> index;
+    NodePool<Node> pool;
+    Node *wheel[kLevels][kSlots] = {};
+    // Bit i of occupied[level] is set while wheel[level][i] is not empty.
+    uint64_t occupied[kLevels] = {};
+    // Last tick the wheel was advanced to.
+    uint64_t current_tick = 0;
+    TimePoint epoch;
+    Duration resolution;
+    Duration default_ttl;
+    ExpirationCallback on_expire;
+
+    [[nodiscard]] uint64_t TickOf(TimePoint time, bool round_up) const;
+
+    [[nodiscard]] uint64_t TicksOf(Duration ttl) const;
+
+    void Place(Node *node);
+
+    void Unlink(Node *node);
+
+    Node *TakeSlot(size_t level, size_t slot);
+
+    void Cascade(size_t level, size_t slot);
+
+    [[nodiscard]] uint64_t NextEventTick(uint64_t target) const;
+
+    static unsigned TrailingZeros(uint64_t mask);
+
+    Node *FindNode(const Key &key);
+
+    void ExpireNode(Node *node);
+
+    size_t ExpireSlot(size_t slot);
+
+    void DestroyNodes();
+
+    template<typename K, typename V>
+    void InsertImpl(K &&key, V &&value, Duration ttl);
+
+public:
+    // --- Constructors ---
+    explicit ExpiringHashTable(Duration default_ttl, Duration resolution = std::chrono::milliseconds(1),
+                               const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual());
+
+    ExpiringHashTable(const ExpiringHashTable &other) = delete;
+
+    ExpiringHashTable(ExpiringHashTable &&other) noexcept;
+
+    // --- Destructor ---
+    ~ExpiringHashTable();
+
+    // --- Overload operators ---
+    ExpiringHashTable &operator=(const ExpiringHashTable &other) = delete;
+
+    ExpiringHashTable &operator=(ExpiringHashTable &&other) noexcept;
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    void Insert(Key &&key, Value &&value);
+
+    void Insert(const Key &key, const Value &value, Duration ttl);
+
+    void Insert(Key &&key, Value &&value, Duration ttl);
+
+    // --- Get element ---
+    Value *Find(const Key &key);
+
+    Value &Get(const Key &key);
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key);
+
+    // --- Expiration ---
+    bool Refresh(const Key &key, Duration ttl);
+
+    size_t Expire();
+
+    size_t ExpireUntil(TimePoint now);
+
+    void SetExpirationCallback(ExpirationCallback callback);
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Check is empty ---
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+uint64_t ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::TickOf(const TimePoint time, const bool round_up) const {
+    if (time <= epoch) {
+        return 0;
+    }
+    const Duration elapsed = time - epoch;
+    auto ticks = static_cast<uint64_t>(elapsed / resolution);
+    if (round_up && elapsed % resolution != Duration::zero()) {
+        ++ticks;
+    }
+    return ticks;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+uint64_t ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::TicksOf(const Duration ttl) const {
+    if (ttl <= Duration::zero()) {
+        return 0;
+    }
+    auto ticks = static_cast<uint64_t>(ttl / resolution);
+    if (ttl % resolution != Duration::zero()) {
+        ++ticks;
+    }
+    return ticks < kMaxTicks ? ticks : kMaxTicks;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Place(Node *node) {
+    uint64_t delta = node->deadline > current_tick ? node->deadline - current_tick : 0;
+    size_t level = 0;
+    while (level + 1 < kLevels && delta >> (kSlotBits * (level + 1)) != 0) {
+        ++level;
+    }
+    if (delta >> (kSlotBits * kLevels) != 0) {
+        // Beyond the range of the wheel: wait in the farthest slot of the last level.
+        delta = (uint64_t{1} << (kSlotBits * kLevels)) - 1;
+    }
+    const auto slot = static_cast<size_t>(((current_tick + delta) >> (kSlotBits * level)) & (kSlots - 1));
+    node->level = static_cast<uint8_t>(level);
+    node->slot = static_cast<uint8_t>(slot);
+    node->previous = nullptr;
+    node->next = wheel[level][slot];
+    if (node->next != nullptr) {
+        node->next->previous = node;
+    }
+    wheel[level][slot] = node;
+    occupied[level] |= uint64_t{1} << slot;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Unlink(Node *node) {
+    if (node->previous != nullptr) {
+        node->previous->next = node->next;
+    } else {
+        wheel[node->level][node->slot] = node->next;
+        if (node->next == nullptr) {
+            occupied[node->level] &= ~(uint64_t{1} << node->slot);
+        }
+    }
+    if (node->next != nullptr) {
+        node->next->previous = node->previous;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+typename ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Node *
+ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::TakeSlot(const size_t level, const size_t slot) {
+    Node *list = wheel[level][slot];
+    wheel[level][slot] = nullptr;
+    occupied[level] &= ~(uint64_t{1} << slot);
+    return list;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Cascade(const size_t level, const size_t slot) {
+    Node *node = TakeSlot(level, slot);
+    while (node != nullptr) {
+        Node *next = node->next;
+        Place(node);
+        node = next;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+uint64_t ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::NextEventTick(const uint64_t target) const {
+    uint64_t next = target;
+    for (size_t level = 0; level < kLevels; ++level) {
+        if (occupied[level] == 0) {
+            continue;
+        }
+        // Slot s of the level is reached at the first tick after current_tick whose digit at the level is s and whose
+        // lower digits are zero.
+        const size_t shift = kSlotBits * level;
+        const size_t current_slot = (current_tick >> shift) & (kSlots - 1);
+        const uint64_t rotation = current_tick >> (shift + kSlotBits) << (shift + kSlotBits);
+        const uint64_t later = current_slot + 1 < kSlots ? occupied[level] >> (current_slot + 1) << (current_slot + 1) : 0;
+        uint64_t tick;
+        if (later != 0) {
+            tick = rotation + (static_cast<uint64_t>(TrailingZeros(later)) << shift);
+        } else {
+            tick = rotation + (uint64_t{1} << (shift + kSlotBits)) +
+                   (static_cast<uint64_t>(TrailingZeros(occupied[level])) << shift);
+        }
+        if (tick < next) {
+            next = tick;
+        }
+    }
+    return next;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+unsigned ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::TrailingZeros(uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#else
+    unsigned count = 0;
+    while ((mask & 1U) == 0) {
+        mask >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+typename ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Node *
+ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::FindNode(const Key &key) {
+    Node **found = index.Find(key);
+    if (found == nullptr) {
+        return nullptr;
+    }
+    Node *node = *found;
+    if (TickOf(Clock::now(), false) >= node->deadline) {
+        Unlink(node);
+        ExpireNode(node);
+        return nullptr;
+    }
+    return node;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::ExpireNode(Node *node) {
+    index.Remove(node->key);
+    if (on_expire) {
+        on_expire(node->key, node->value);
+    }
+    pool.Destroy(node);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+size_t ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::ExpireSlot(const size_t slot) {
+    size_t expired = 0;
+    Node *node = TakeSlot(0, slot);
+    while (node != nullptr) {
+        Node *next = node->next;
+        ExpireNode(node);
+        ++expired;
+        node = next;
+    }
+    return expired;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::DestroyNodes() {
+    for (size_t level = 0; level < kLevels; ++level) {
+        for (size_t slot = 0; slot < kSlots; ++slot) {
+            Node *node = TakeSlot(level, slot);
+            while (node != nullptr) {
+                Node *next = node->next;
+                pool.Destroy(node);
+                node = next;
+            }
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+template<typename K, typename V>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::InsertImpl(K &&key, V &&value, const Duration ttl) {
+    const uint64_t deadline = TickOf(Clock::now(), true) + TicksOf(ttl);
+    if (Node **found = index.Find(key); found != nullptr) {
+        Node *node = *found;
+        node->value = std::forward<V>(value);
+        Unlink(node);
+        node->deadline = deadline;
+        Place(node);
+        return;
+    }
+    Node *node = pool.Create(std::forward<K>(key), std::forward<V>(value), deadline);
+    try {
+        index.Insert(node->key, node);
+    } catch (...) {
+        pool.Destroy(node);
+        throw;
+    }
+    Place(node);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::ExpiringHashTable(const Duration default_ttl,
+                                                                        const Duration resolution, const Hash &hash,
+                                                                        const KeyEqual &equal)
+    : index(16, 0.75, hash, equal), epoch(Clock::now()),
+      resolution(resolution > Duration::zero() ? resolution : Duration(1)), default_ttl(default_ttl) {
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::ExpiringHashTable(ExpiringHashTable &&other) noexcept
+    : index(std::move(other.index)), pool(std::move(other.pool)), current_tick(other.current_tick),
+      epoch(other.epoch), resolution(other.resolution), default_ttl(other.default_ttl),
+      on_expire(std::move(other.on_expire)) {
+    for (size_t level = 0; level < kLevels; ++level) {
+        for (size_t slot = 0; slot < kSlots; ++slot) {
+            wheel[level][slot] = other.wheel[level][slot];
+            other.wheel[level][slot] = nullptr;
+        }
+        occupied[level] = other.occupied[level];
+        other.occupied[level] = 0;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::~ExpiringHashTable() {
+    DestroyNodes();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock> &
+ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::operator=(ExpiringHashTable &&other) noexcept {
+    if (this != &other) {
+        DestroyNodes();
+        index = std::move(other.index);
+        pool = std::move(other.pool);
+        current_tick = other.current_tick;
+        epoch = other.epoch;
+        resolution = other.resolution;
+        default_ttl = other.default_ttl;
+        on_expire = std::move(other.on_expire);
+        for (size_t level = 0; level < kLevels; ++level) {
+            for (size_t slot = 0; slot < kSlots; ++slot) {
+                wheel[level][slot] = other.wheel[level][slot];
+                other.wheel[level][slot] = nullptr;
+            }
+            occupied[level] = other.occupied[level];
+            other.occupied[level] = 0;
+        }
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Insert(const Key &key, const Value &value) {
+    InsertImpl(key, value, default_ttl);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Insert(Key &&key, Value &&value) {
+    InsertImpl(std::move(key), std::move(value), default_ttl);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Insert(const Key &key, const Value &value,
+                                                                 const Duration ttl) {
+    InsertImpl(key, value, ttl);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Insert(Key &&key, Value &&value, const Duration ttl) {
+    InsertImpl(std::move(key), std::move(value), ttl);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+Value *ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Find(const Key &key) {
+    Node *node = FindNode(key);
+    return node == nullptr ? nullptr : &node->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+Value &ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Get(const Key &key) {
+    Value *value = Find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+bool ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::ContainsKey(const Key &key) {
+    return Find(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+bool ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Refresh(const Key &key, const Duration ttl) {
+    Node *node = FindNode(key);
+    if (node == nullptr) {
+        return false;
+    }
+    Unlink(node);
+    node->deadline = TickOf(Clock::now(), true) + TicksOf(ttl);
+    Place(node);
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+size_t ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Expire() {
+    return ExpireUntil(Clock::now());
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+size_t ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::ExpireUntil(const TimePoint now) {
+    const uint64_t target = TickOf(now, false);
+    if (target < current_tick) {
+        return 0;
+    }
+    // Pairs inserted already due (e.g. with a zero ttl) wait in the slot of current_tick.
+    size_t expired = ExpireSlot(current_tick & (kSlots - 1));
+    while (current_tick < target) {
+        current_tick = NextEventTick(target);
+        // Coarse levels first: their pairs may move down into a slot of a finer level that is due at this tick.
+        for (size_t level = kLevels - 1; level > 0; --level) {
+            const size_t shift = kSlotBits * level;
+            if ((current_tick & ((uint64_t{1} << shift) - 1)) == 0) {
+                Cascade(level, (current_tick >> shift) & (kSlots - 1));
+            }
+        }
+        expired += ExpireSlot(current_tick & (kSlots - 1));
+    }
+    return expired;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::SetExpirationCallback(ExpirationCallback callback) {
+    on_expire = std::move(callback);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Remove(const Key &key) {
+    Node **found = index.Find(key);
+    if (found == nullptr) {
+        throw std::out_of_range("No such key exists!\n");
+    }
+    Node *node = *found;
+    Unlink(node);
+    index.Remove(key);
+    pool.Destroy(node);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Clear() {
+    DestroyNodes();
+    index.Clear();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+bool ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::IsEmpty() const {
+    return index.IsEmpty();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+size_t ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Size() const {
+    return index.Size();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, typename Clock>
+void ExpiringHashTable<Key, Value, Hash, KeyEqual, Clock>::Show() const {
+    for (size_t level = 0; level < kLevels; ++level) {
+        for (size_t slot = 0; slot < kSlots; ++slot) {
+            for (const Node *node = wheel[level][slot]; node != nullptr; node = node->next) {
+                std::cout << "[" << node->key << ", " << node->value << ", " << node->deadline << "] -> ";
+            }
+        }
+    }
+    std::cout << "nullptr" << std::endl;
+}
+
+
+#endif //EXPIRINGHASHTABLE_H
@@ -0,0 +1,520 @@
+#ifndef FLATHASHTABLE_H
+#define FLATHASHTABLE_H
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "HashMix.h"
+#include "SeededHash.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FLATHASHTABLE_SSE2 1
+#endif
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" with open addressing (SwissTable layout).
+ *
+ * The FlatHashTable class provides the same surface as HashTable, but keeps the entries in a flat slot array
+ * instead of heap-allocated chains. Every slot has a one byte control value stored in a separate metadata array:
+ * either "empty", "deleted" or the low 7 bits of the hash of the key stored in the slot.
+ *
+ * Constructors:
+ *  - FlatHashTable(size_t capacity = 16): Initializes an empty table with at least the given number of slots.
+ *  - FlatHashTable(const FlatHashTable &other): Copy constructor, creates a deep copy of another table.
+ *  - FlatHashTable(FlatHashTable &&other) noexcept: Move constructor, transfers ownership of the slot arrays.
+ *
+ * Destructor:
+ *  - ~FlatHashTable(): Destroys all stored entries and releases the slot and metadata arrays.
+ *
+ * Overloaded Operators:
+ *  - FlatHashTable& operator=(const FlatHashTable &other): Copy assignment operator.
+ *  - FlatHashTable& operator=(FlatHashTable &&other) noexcept: Move assignment operator.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value): Inserts a key-value pair, overwriting the value of an existing key.
+ *  - Value &Get(const Key &key): Retrieves the value associated with the key. Throws an exception if the key is not found.
+ *  - void Remove(const Key &key): Removes the key. Throws an exception if the key is not found.
+ *  - void Clear(): Removes all key-value pairs, keeping the allocated capacity.
+ *  - bool ContainsKey(const Key &key): Returns true if the table contains the key, false otherwise.
+ *  - [[nodiscard]] bool IsEmpty() const: Returns true if the table is empty.
+ *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs in the table.
+ *  - [[nodiscard]] size_t Capacity() const: Returns the number of slots in the table.
+ *  - void Resize(): Doubles the number of slots and reinserts every entry.
+ *
+ * Time Complexity:
+ *  - Insert: O(1) on average, amortized over the resizes.
+ *  - Get: O(1) on average.
+ *  - Remove: O(1) on average.
+ *  - ContainsKey: O(1) on average.
+ *  - Clear: O(n) if the entries need destruction, otherwise O(capacity / 16) to reset the metadata.
+ *  - Resize: O(n).
+ *
+ * Features:
+ * - Lookups probe the metadata in groups of 16 bytes. With SSE2 a whole group is compared against the 7 bit hash
+ *   fragment with a single instruction, so the key is compared only for slots whose fragment already matches.
+ * - Groups are visited with triangular (quadratic) probing, which visits every group of a power-of-two table.
+ * - No allocation is made per entry: keys and values live directly in the slot array.
+ * - Removal leaves a "deleted" marker, which is dropped the next time the table is rehashed.
+ * - The maximum load factor is 7/8.
+ * - The group index and the 7 bit fragment come from a SeededHash with a random seed per table (see SeededHash.h).
+ *   A copy keeps the seed of its source, because the control bytes are copied as they are.
+ */
+template<typename Key, typename Value>
+class FlatHashTable {
+    struct Slot {
+        Key key;
+        Value value;
+
+        Slot(const Key &key, const Value &value) : key(key), value(value) {
+        }
+    };
+
+    using Control = int8_t;
+
+    static constexpr Control kEmpty = -128;
+    static constexpr Control kDeleted = -2;
+    static constexpr size_t kGroupWidth = 16;
+
+    /*
+     * Group class:
+     * - Group: A view of 16 consecutive control bytes. Every Match* method returns a bit mask where bit i is set
+     *   when the control byte i of the group satisfies the condition.
+     */
+    class Group {
+#ifdef FLATHASHTABLE_SSE2
+        __m128i control;
+#else
+        Control control[kGroupWidth];
+#endif
+
+    public:
+        explicit Group(const Control *position);
+
+        [[nodiscard]] uint32_t Match(Control fragment) const;
+
+        [[nodiscard]] uint32_t MatchEmpty() const;
+
+        [[nodiscard]] uint32_t MatchEmptyOrDeleted() const;
+    };
+
+    Control *control;
+    Slot *slots;
+    size_t capacity;
+    size_t element_count;
+    size_t growth_left;
+    SeededHash<Key> hasher;
+
+    static size_t MaxLoad(size_t capacity);
+
+    static size_t NormalizeCapacity(size_t capacity);
+
+    static unsigned TrailingZeros(uint32_t mask);
+
+    [[nodiscard]] size_t HashFunction(const Key &key) const;
+
+    void Allocate(size_t new_capacity);
+
+    void Deallocate();
+
+    void DestroySlots();
+
+    void SetControl(size_t index, Control value);
+
+    [[nodiscard]] size_t FindIndex(const Key &key, size_t hash) const;
+
+    [[nodiscard]] size_t FindInsertIndex(size_t hash) const;
+
+    void Rehash(size_t new_capacity);
+
+    void CopyFrom(const FlatHashTable &other);
+
+public:
+    // --- Constructors ---
+    explicit FlatHashTable(size_t capacity = 16);
+
+    FlatHashTable(const FlatHashTable &other);
+
+    FlatHashTable(FlatHashTable &&other) noexcept;
+
+    // --- Overload operators ---
+    FlatHashTable &operator=(const FlatHashTable &other);
+
+    FlatHashTable &operator=(FlatHashTable &&other) noexcept;
+
+    // --- Destructors ---
+    ~FlatHashTable();
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    // --- Get element ---
+    Value &Get(const Key &key);
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key);
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t Capacity() const;
+
+    // --- Change size in hash table ---
+    void Resize();
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value>
+FlatHashTable<Key, Value>::Group::Group(const Control *position) {
+#ifdef FLATHASHTABLE_SSE2
+    control = _mm_loadu_si128(reinterpret_cast<const __m128i *>(position));
+#else
+    std::memcpy(control, position, kGroupWidth);
+#endif
+}
+
+template<typename Key, typename Value>
+uint32_t FlatHashTable<Key, Value>::Group::Match(const Control fragment) const {
+#ifdef FLATHASHTABLE_SSE2
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(fragment), control)));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+        mask |= static_cast<uint32_t>(control[i] == fragment) << i;
+    }
+    return mask;
+#endif
+}
+
+template<typename Key, typename Value>
+uint32_t FlatHashTable<Key, Value>::Group::MatchEmpty() const {
+    return Match(kEmpty);
+}
+
+template<typename Key, typename Value>
+uint32_t FlatHashTable<Key, Value>::Group::MatchEmptyOrDeleted() const {
+    // Full slots hold a fragment in [0, 127], both markers are negative.
+#ifdef FLATHASHTABLE_SSE2
+    return static_cast<uint32_t>(_mm_movemask_epi8(control));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+        mask |= static_cast<uint32_t>(control[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+template<typename Key, typename Value>
+size_t FlatHashTable<Key, Value>::MaxLoad(const size_t capacity) {
+    return capacity - capacity / 8;
+}
+
+template<typename Key, typename Value>
+size_t FlatHashTable<Key, Value>::NormalizeCapacity(const size_t capacity) {
+    size_t result = kGroupWidth;
+    while (result < capacity) {
+        result *= 2;
+    }
+    return result;
+}
+
+template<typename Key, typename Value>
+unsigned FlatHashTable<Key, Value>::TrailingZeros(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+    unsigned count = 0;
+    while ((mask & 1U) == 0) {
+        mask >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+template<typename Key, typename Value>
+size_t FlatHashTable<Key, Value>::HashFunction(const Key &key) const {
+    // The group index and the 7 bit fragment are both taken from the hash, so every bit of it has to be mixed.
+    return MixHash(hasher(key));
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::Allocate(const size_t new_capacity) {
+    // The first group is mirrored after the last slot, so a group can be loaded from any slot index.
+    control = new Control[new_capacity + kGroupWidth];
+    std::memset(control, kEmpty, new_capacity + kGroupWidth);
+    slots = std::allocator<Slot>().allocate(new_capacity);
+    capacity = new_capacity;
+    growth_left = MaxLoad(new_capacity);
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::Deallocate() {
+    if (slots != nullptr) {
+        std::allocator<Slot>().deallocate(slots, capacity);
+    }
+    delete[] control;
+    control = nullptr;
+    slots = nullptr;
+    capacity = 0;
+    growth_left = 0;
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::DestroySlots() {
+    if constexpr (!std::is_trivially_destructible_v<Slot>) {
+        for (size_t i = 0; i < capacity; ++i) {
+            if (control[i] >= 0) {
+                slots[i].~Slot();
+            }
+        }
+    }
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::SetControl(const size_t index, const Control value) {
+    control[index] = value;
+    if (index < kGroupWidth) {
+        control[capacity + index] = value;
+    }
+}
+
+template<typename Key, typename Value>
+size_t FlatHashTable<Key, Value>::FindIndex(const Key &key, const size_t hash) const {
+    const size_t mask = capacity - 1;
+    const auto fragment = static_cast<Control>(hash & 0x7F);
+    size_t position = (hash >> 7) & mask;
+    size_t step = 0;
+    while (true) {
+        Group group(control + position);
+        for (uint32_t match = group.Match(fragment); match != 0; match &= match - 1) {
+            size_t index = (position + TrailingZeros(match)) & mask;
+            if (slots[index].key == key) {
+                return index;
+            }
+        }
+        if (group.MatchEmpty() != 0) {
+            return capacity;
+        }
+        step += kGroupWidth;
+        position = (position + step) & mask;
+    }
+}
+
+template<typename Key, typename Value>
+size_t FlatHashTable<Key, Value>::FindInsertIndex(const size_t hash) const {
+    const size_t mask = capacity - 1;
+    size_t position = (hash >> 7) & mask;
+    size_t step = 0;
+    while (true) {
+        const uint32_t free = Group(control + position).MatchEmptyOrDeleted();
+        if (free != 0) {
+            return (position + TrailingZeros(free)) & mask;
+        }
+        step += kGroupWidth;
+        position = (position + step) & mask;
+    }
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::Rehash(const size_t new_capacity) {
+    Control *old_control = control;
+    Slot *old_slots = slots;
+    const size_t old_capacity = capacity;
+
+    Allocate(new_capacity);
+    for (size_t i = 0; i < old_capacity; ++i) {
+        if (old_control[i] >= 0) {
+            const size_t hash = HashFunction(old_slots[i].key);
+            const size_t index = FindInsertIndex(hash);
+            new(slots + index) Slot(std::move(old_slots[i]));
+            SetControl(index, static_cast<Control>(hash & 0x7F));
+            old_slots[i].~Slot();
+        }
+    }
+    growth_left -= element_count;
+
+    std::allocator<Slot>().deallocate(old_slots, old_capacity);
+    delete[] old_control;
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::CopyFrom(const FlatHashTable &other) {
+    Allocate(other.capacity);
+    for (size_t i = 0; i < other.capacity; ++i) {
+        if (other.control[i] >= 0) {
+            new(slots + i) Slot(other.slots[i]);
+        }
+    }
+    std::memcpy(control, other.control, capacity + kGroupWidth);
+    element_count = other.element_count;
+    growth_left = other.growth_left;
+    hasher = other.hasher;
+}
+
+template<typename Key, typename Value>
+FlatHashTable<Key, Value>::FlatHashTable(const size_t capacity)
+    : control(nullptr), slots(nullptr), capacity(0), element_count(0), growth_left(0) {
+    Allocate(NormalizeCapacity(capacity));
+}
+
+template<typename Key, typename Value>
+FlatHashTable<Key, Value>::FlatHashTable(const FlatHashTable &other)
+    : control(nullptr), slots(nullptr), capacity(0), element_count(0), growth_left(0) {
+    CopyFrom(other);
+}
+
+template<typename Key, typename Value>
+FlatHashTable<Key, Value>::FlatHashTable(FlatHashTable &&other) noexcept
+    : control(other.control), slots(other.slots), capacity(other.capacity), element_count(other.element_count),
+      growth_left(other.growth_left), hasher(other.hasher) {
+    other.control = nullptr;
+    other.slots = nullptr;
+    other.capacity = 0;
+    other.element_count = 0;
+    other.growth_left = 0;
+}
+
+template<typename Key, typename Value>
+FlatHashTable<Key, Value> &FlatHashTable<Key, Value>::operator=(const FlatHashTable &other) {
+    if (this != &other) {
+        DestroySlots();
+        Deallocate();
+        element_count = 0;
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value>
+FlatHashTable<Key, Value> &FlatHashTable<Key, Value>::operator=(FlatHashTable &&other) noexcept {
+    if (this != &other) {
+        DestroySlots();
+        Deallocate();
+        control = other.control;
+        slots = other.slots;
+        capacity = other.capacity;
+        element_count = other.element_count;
+        growth_left = other.growth_left;
+        hasher = other.hasher;
+
+        other.control = nullptr;
+        other.slots = nullptr;
+        other.capacity = 0;
+        other.element_count = 0;
+        other.growth_left = 0;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value>
+FlatHashTable<Key, Value>::~FlatHashTable() {
+    DestroySlots();
+    Deallocate();
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::Insert(const Key &key, const Value &value) {
+    if (capacity == 0) {
+        Allocate(kGroupWidth);
+    }
+    const size_t hash = HashFunction(key);
+    size_t index = FindIndex(key, hash);
+    if (index != capacity) {
+        slots[index].value = value;
+        return;
+    }
+
+    index = FindInsertIndex(hash);
+    if (growth_left == 0 && control[index] == kEmpty) {
+        // Rehashing drops the deleted markers, so only grow when the table is really full of live entries.
+        Rehash(element_count * 2 > MaxLoad(capacity) ? capacity * 2 : capacity);
+        index = FindInsertIndex(hash);
+    }
+    new(slots + index) Slot(key, value);
+    if (control[index] == kEmpty) {
+        --growth_left;
+    }
+    SetControl(index, static_cast<Control>(hash & 0x7F));
+    ++element_count;
+}
+
+template<typename Key, typename Value>
+Value &FlatHashTable<Key, Value>::Get(const Key &key) {
+    const size_t index = capacity == 0 ? 0 : FindIndex(key, HashFunction(key));
+    if (index == capacity) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return slots[index].value;
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::Remove(const Key &key) {
+    const size_t index = capacity == 0 ? 0 : FindIndex(key, HashFunction(key));
+    if (index == capacity) {
+        throw std::out_of_range("No such key exists!\n");
+    }
+    slots[index].~Slot();
+    SetControl(index, kDeleted);
+    --element_count;
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::Clear() {
+    if (capacity == 0) {
+        return;
+    }
+    DestroySlots();
+    std::memset(control, kEmpty, capacity + kGroupWidth);
+    element_count = 0;
+    growth_left = MaxLoad(capacity);
+}
+
+template<typename Key, typename Value>
+bool FlatHashTable<Key, Value>::ContainsKey(const Key &key) {
+    return capacity != 0 && FindIndex(key, HashFunction(key)) != capacity;
+}
+
+template<typename Key, typename Value>
+bool FlatHashTable<Key, Value>::IsEmpty() const {
+    return element_count == 0;
+}
+
+template<typename Key, typename Value>
+size_t FlatHashTable<Key, Value>::Size() const {
+    return element_count;
+}
+
+template<typename Key, typename Value>
+size_t FlatHashTable<Key, Value>::Capacity() const {
+    return capacity;
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::Resize() {
+    Rehash(capacity == 0 ? kGroupWidth : capacity * 2);
+}
+
+template<typename Key, typename Value>
+void FlatHashTable<Key, Value>::Show() const {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (control[i] >= 0) {
+            std::cout << "Slot number: " << i << ": [" << slots[i].key << ", " << slots[i].value << "]" << std::endl;
+        }
+    }
+}
+
+
+#endif //FLATHASHTABLE_H
@@ -0,0 +1,24 @@
+#ifndef HASHMIX_H
+#define HASHMIX_H
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Mixing finalizer for hash values (the 64 bit finalizer of MurmurHash3).
+ *
+ * Tables that take the bucket index from the low bits of the hash with a mask need every input bit to affect
+ * those bits. std::hash is the identity for integers on common standard libraries, so sequential or aligned keys
+ * would otherwise fall into a few buckets. It is constexpr, so tables built at compile time can use it too.
+ */
+constexpr size_t MixHash(const size_t hash) {
+    uint64_t x = static_cast<uint64_t>(hash);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return static_cast<size_t>(x);
+}
+
+
+#endif //HASHMIX_H
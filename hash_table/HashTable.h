@@ -1,14 +1,33 @@
 #ifndef HASHTABLE_H
 #define HASHTABLE_H
+#include<algorithm>
+#include<cmath>
+#include<exception>
+#include<iterator>
+#include<array>
+#include<utility>
 #include<vector>
 #include<memory>
+#include<functional>
+#include<iostream>
+#include<stdexcept>
+#include<thread>
+#include<string>
+#include<string_view>
+#include<type_traits>
+#include "HashMix.h"
+#include "HashTableSnapshot.h"
+#include "HashTableStats.h"
+#include "NodePool.h"
+#include "SeededHash.h"
 /**
  * Implementation of the Abstract Data Type (ADT) "Hash Table".
  *
  * The HashTable class provides basic operations for working with a hash table:
  *
  * Constructors:
- *  - HashTable(size_t table_size = 16, float load_factor = 0.75): Initializes a hash table with a specified size and load factor.
+ *  - HashTable(size_t table_size = 16, float load_factor = 0.75, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual()):
+ *    Initializes a hash table with a specified size, load factor, hash function and key equality.
  *  - HashTable(const HashTable &other): Copy constructor, creates a deep copy of another hash table.
  *  - HashTable(HashTable &&other) noexcept: Move constructor, transfers ownership of resources from another hash table.
  *
@@ -21,57 +40,372 @@
  *
  * Public Methods:
  *  - void Insert(const Key &key, const Value &value): Inserts a key-value pair into the hash table, handling collisions as needed.
- *  - Value &Get(const Key &key): Retrieves the value associated with the specified key. Throws an exception if the key is not found.
- *  - void Remove(const Key &key): Removes the specified key and its associated value from the hash table, if it exists.
+ *  - void Insert(Key &&key, Value &&value): Same as Insert, but moves the key and the value into the new node.
+ *  - Value &Emplace(key, Args &&... args): Constructs the value in place from args. An existing value is replaced by
+ *    a value constructed from args. Returns a reference to the stored value.
+ *  - bool TryEmplace(key, Args &&... args): Constructs the value in place from args only if the key is not present yet.
+ *    The arguments are left untouched if the key exists. Returns true if the key was inserted.
+ *  - bool InsertOrAssign(key, V &&value): Inserts the value or assigns it to the existing key, forwarding it in both
+ *    cases. Returns true if the key was inserted.
+ *  - Value &Get(const K &key): Retrieves the value associated with the specified key. Throws an exception if the key is not found.
+ *  - Value *Find(const K &key): Returns a pointer to the value associated with the key, or nullptr if it is not found.
+ *  - size_t Count(const K &key): Returns the number of pairs with the key; more than 1 only after InsertMulti.
+ *  - std::pair<Iterator, Iterator> EqualRange(const K &key): Returns the range of all pairs with the key. Completes a
+ *    pending incremental resize.
+ *  - std::vector<Value *> GetMany(const std::vector<Key> &keys): Looks up a batch of keys. The result holds a pointer to
+ *    the value of every key, or nullptr for a missing key.
+ *  - std::vector<bool> ContainsMany(const std::vector<Key> &keys): Checks a batch of keys.
+ *  - void InsertMany(const std::vector<std::pair<Key, Value> > &entries): Inserts a batch of key-value pairs,
+ *    overwriting the values of existing keys.
+ *  - Value &InsertMulti(const Key &key, const Value &value) / InsertMulti(Key &&key, Value &&value): Inserts the pair
+ *    even if the key is already present (multimap mode). Returns a reference to the new value.
+ *  - Value &Increment(const Key &key, const Value &delta = Value(1)): Adds delta to the value of the key, inserting
+ *    the key with the value delta if it is not present (counter mode). Returns a reference to the updated value.
+ *  - void Remove(const K &key): Removes the specified key and its associated value from the hash table, if it exists.
  *  - void Clear(): Removes all key-value pairs from the hash table, effectively clearing it.
- *  - bool ContainsKey(const Key &key): Returns true if the hash table contains the specified key, false otherwise.
+ *  - bool ContainsKey(const K &key): Returns true if the hash table contains the specified key, false otherwise.
  *  - [[nodiscard]] bool IsEmpty() const: Returns true if the hash table is empty, false otherwise.
+ *    Get, Remove and ContainsKey take a const Key & unless both Hash and KeyEqual are transparent (see below).
  *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs in the hash table.
- *  - void Resize(size_t newSize): Resizes the hash table to a new size, which can be larger or smaller.
+ *  - void Resize(): Multiplies the number of buckets by the growth factor (2 by default). In incremental mode only the new bucket array is allocated here,
+ *    and the chains are moved by the following operations.
+ *  - void Reserve(size_t count): Grows the table at once to hold count key-value pairs without another resize.
+ *  - void ShrinkToFit(): Shrinks the bucket array to the smallest size that holds the current key-value pairs.
+ *  - void SetGrowthFactor(float factor): Sets the factor applied to the number of buckets by Resize. Must be above 1.
+ *  - void SetMaxLoadFactor(float load_factor): Sets the load factor above which Insert resizes the table.
+ *  - void SetMaxChainLength(size_t length): Sets the chain length above which an insertion re-seeds the hash (16).
+ *  - [[nodiscard]] float GrowthFactor() const / float MaxLoadFactor() const: Return the current growth policy.
+ *  - [[nodiscard]] size_t BucketCount() const: Returns the number of buckets.
+ *  - [[nodiscard]] HashTableStats Stats() const: Returns the chain length histogram, the longest chain, the share of
+ *    empty buckets, the number of resizes, the memory used and the expected comparisons per lookup (HashTableStats.h).
+ *  - void SetIncrementalResize(bool enabled): Switches the incremental (amortized) resize mode on or off.
+ *  - [[nodiscard]] bool IsResizing() const: Returns true while an incremental resize is still moving buckets.
+ *  - Iterator Begin(): Returns an iterator to the first key-value pair. Completes a pending incremental resize.
+ *  - Iterator End(): Returns an iterator past the last key-value pair.
+ *  - begin() / end(): Same as Begin() and End(), for range-based for loops: for (auto [key, value] : table).
+ *  - void SaveSnapshot(const std::string &path) const: Writes the table to a binary snapshot file (HashTableSnapshot.h).
+ *    Only for trivially copyable keys and values. Throws std::runtime_error if the file can not be written.
+ *  - static HashTable LoadSnapshot(const std::string &path, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual()):
+ *    Builds a table from a snapshot file. Throws std::runtime_error if the file is not a valid snapshot.
+ *  - void ParallelForEach(Function function, unsigned thread_count = 0): Calls function(const Key &, Value &) for every
+ *    key-value pair. The buckets are split into contiguous ranges that are visited by thread_count threads (the
+ *    number of hardware threads for 0). The function must be safe to call concurrently.
+ *  - void BuildFrom(const Range &range, unsigned thread_count = 0): Inserts every pair of a random-access range of
+ *    std::pair<Key, Value> (or anything with first and second) with thread_count threads, overwriting the values of
+ *    existing keys like Insert.
+ *  - void MergeFrom(HashTable &&other, unsigned thread_count = 0): Moves every pair of other into this table with
+ *    thread_count threads. The nodes of other are relinked, not copied; a pair of other replaces the pair of this
+ *    table with the same key. If either table is in multimap mode, the pairs of other are added next to the pairs of
+ *    this table with the same key and nothing is replaced. Leaves other empty. If KeyEqual throws, both tables are
+ *    left unchanged.
  *
  * Private Methods:
- *  - int HashFunction(const Key &key) const: Computes the hash code for a given key, determining its index in the hash table.
+ *  - size_t HashFunction(const Key &key) const: Computes the hash code for a given key, determining its index in the hash table.
+ *  - size_t IndexFor(size_t hash, size_t bucket_count): Maps a full hash to a bucket index, with a mask for power-of-two
+ *    bucket counts and with a division otherwise.
+ *  - bool Matches(const Node *node, size_t hash, const K &key) const: Compares the stored hash first, if there is one,
+ *    and calls KeyEqual only for equal hashes. SameKey does the same without updating the counters, for the threads
+ *    of BuildFrom and MergeFrom.
+ *  - static std::exception_ptr RunTasks(size_t task_count, Function function): Runs function(task) for every task, the
+ *    first one on the calling thread and every other one on a thread of its own. Returns the first exception thrown.
+ *    If a thread can not be started, the calling thread runs the remaining tasks itself.
  *  - void CopyBuckets(const HashTable &hash_table): Copies the elements from another hash table into this one.
+ *  - void DestroyNodes(): Runs the node destructors if they are not trivial and releases all node slabs.
+ *  - Node *&BucketFor(size_t hash): Returns the bucket that holds the hash, old or new while resizing.
+ *  - void RehashStep(): Moves a bounded number of buckets from the old bucket array into the new one.
+ *  - void FinishRehash(): Moves all remaining buckets, ending an incremental resize.
+ *  - void Rehash(size_t new_size, bool incremental): Allocates a bucket array of new_size buckets and moves the chains,
+ *    at once or incrementally. Resize, Reserve and ShrinkToFit are built on it.
+ *  - void Reseed(): Gives a reseedable hash a new random seed and relinks every node under its new hash.
+ *  - size_t BucketCountFor(size_t count) const: Smallest number of buckets that holds count pairs below the maximum
+ *    load factor, rounded up to a power of two if the table is in the mask mode.
+ *  - void PrefetchBuckets(size_t count, KeyOf key_of, Node **bucket_refs[]): Finds the buckets of a batch of keys and
+ *    prefetches the bucket slots and the first nodes of their chains.
+ *  - void FindMany(const Key *keys, size_t count, Node *found[]): Batched lookup shared by GetMany and ContainsMany.
+ *  - std::pair<Node *, bool> TryEmplaceNode(K &&key, Args &&... args): Finds the node of the key, or constructs a new
+ *    node in place from the forwarded key and value arguments. Every insertion method is built on it.
+ *  - Node *EmplaceMultiNode(K &&key, Args &&... args): Constructs a new node even if the key is present, linking it
+ *    in front of the nodes with an equal key.
  *
  * Time Complexity:
  *  - Insert: O(1) on average, O(n) in the worst case (due to collisions).
  *  - Get: O(1) on average, O(n) in the worst case (if many collisions occur).
+ *  - Find: O(1) on average, O(n) in the worst case.
  *  - Remove: O(1) on average, O(n) in the worst case.
- *  - Clear: O(n) - Each key-value pair is visited and deleted.
+ *  - Clear: O(n) if the keys or values have destructors, otherwise O(table_size) - the node slabs are freed as a whole.
  *  - ContainsKey: O(1) on average, O(n) in the worst case.
+ *  - GetMany, ContainsMany, InsertMany: O(k) on average for k keys.
+ *  - InsertMulti, Increment: O(1) on average; InsertMulti stops at the first node with an equal key.
+ *  - Count, EqualRange: O(1 + number of pairs with the key) on average.
+ *  - Begin, operator++: O(1) amortized over a full traversal of O(n + table_size).
+ *  - ParallelForEach: O((n + table_size) / thread_count).
+ *  - BuildFrom, MergeFrom: O((k + table_size) / thread_count) on average for k new pairs, plus one Reserve.
+ *  - Reserve, ShrinkToFit: O(n + table_size), with a single bucket array allocation.
+ *  - Stats: O(n + table_size).
+ *  - SaveSnapshot, LoadSnapshot: O(n + table_size), with no hashing of the keys if StoreHash is set (Load never hashes).
  *  - IsEmpty: O(1) - Simply checks if the count of elements is zero.
  *  - Size: O(1) - Returns the stored count of key-value pairs.
  *
  * Features:
  * - The Hash Table uses a hash function to map keys to indices, providing efficient access to values.
+ * - The hash function and the key equality are template parameters (SeededHash and std::equal_to by default), and
+ *   the table keeps an instance of both.
+ * - SeededHash is a keyed hash with a random seed per table, so which keys collide differs between tables and
+ *   processes. If an insertion still finds a chain longer than the maximum chain length, a hash with Reseed(uint64_t)
+ *   (see HashTableIsReseedable) gets a new random seed and the whole table is relinked; another re-seed needs the table
+ *   to double in size first. Hash functors without Reseed, like std::hash, are used as they are.
+ * - When the number of buckets is a power of two (the default size, and doubling keeps it so) the index is taken
+ *   from the mixed hash with a mask instead of the % operator.
+ * - With StoreHash (the default for non-arithmetic keys) every node keeps the full hash of its key: Resize does not
+ *   re-hash the keys, and chain walks skip nodes with a different hash without comparing the keys.
+ * - Heterogeneous lookup: when Hash and KeyEqual both declare is_transparent, Get, Remove and ContainsKey accept any
+ *   type the functors accept and use it as is. For example, HashTable<std::string, Value, TransparentStringHash,
+ *   std::equal_to<> > looks up a std::string_view or a const char * without building a temporary std::string.
  * - The load factor determines when to resize the hash table to maintain performance as elements are added.
+ *   Both the maximum load factor and the growth factor of Resize can be changed at runtime. A bulk load of a known
+ *   size can call Reserve first and does a single bucket allocation; ShrinkToFit gives the bucket memory back after
+ *   a mass Remove. With a growth factor other than 2 a power-of-two table leaves the mask mode on its next Resize.
  * - Collision resolution is handled through chaining with linked lists, allowing multiple values to be stored at the same index.
+ * - Multimap mode: InsertMulti keeps several pairs with one key in a single chain, always next to each other, so Count
+ *   and EqualRange walk one contiguous run. Resizing, re-seeding, copying, merging and snapshots keep the runs
+ *   together. Insert, Get and Remove act on the first pair of a run. The table enters the mode with its first
+ *   InsertMulti, and a loaded snapshot that holds a key twice starts in it. The counter mode Increment finds or inserts the key in one chain walk.
+ * - Chain nodes are allocated from a NodePool owned by the table: large contiguous slabs instead of one allocation per
+ *   node. Removed nodes are recycled by the next insertion, and Clear releases the slabs at once.
+ * - SaveSnapshot writes the pairs grouped by bucket together with their hashes. LoadSnapshot maps the file, makes one
+ *   bucket allocation and links the nodes in directly, which is much faster than inserting the pairs one by one.
+ *   A snapshot can also be served read-only, without building a table at all, through HashTableSnapshot.
+ * - In incremental resize mode the old and the new bucket arrays are kept alive together. Every Insert, Get, Remove and
+ *   ContainsKey moves a few old buckets, so no single operation pays for rehashing the whole table. Old buckets below
+ *   the migration index are already moved, so a key is looked up in the old array if its old bucket is not moved yet
+ *   and in the new array otherwise.
+ * - BuildFrom and MergeFrom hash the new pairs in parallel and partition them by the range of buckets their hash falls
+ *   into, the same ranges ParallelForEach uses. Then every thread links the pairs of one range, so no two threads
+ *   touch the same chain and no locks are needed. New nodes come from a NodePool per thread, and the pools are
+ *   absorbed by the pool of the table afterwards; MergeFrom absorbs the pool of other and only relinks its nodes.
+ *   Inputs below kParallelGrain pairs per thread use fewer threads.
+ * - The batched operations work in groups of kPrefetchBatch keys: all keys of a group are hashed and their buckets and
+ *   first nodes are prefetched before any chain is walked, so the memory latency of the keys overlaps.
+ * - Defining HASHTABLE_ENABLE_COUNTERS before including this header makes every lookup, insert and remove update
+ *   per-operation counters, which Stats() reports as well. Without it the increments are not compiled in; the
+ *   counter field itself is always there, so translation units that disagree on the macro still agree on the layout.
  * - Provides a dynamic and efficient way to store and retrieve key-value pairs with average constant time complexity for operations.
  *
  * @author Vlas Pototskyi
  */
-template<typename Key, typename Value>
+/*
+ * HashTableStoredHash:
+ * - Base of the HashTable node. With Enabled the full hash of the key is kept in the node, so resizing does not call
+ *   the hash function again and a chain walk compares keys only when the hashes are equal. Without it the node has
+ *   no extra field.
+ */
+template<bool Enabled>
+struct HashTableStoredHash {
+    size_t hash;
+
+    explicit HashTableStoredHash(const size_t hash) : hash(hash) {
+    }
+};
+
+template<>
+struct HashTableStoredHash<false> {
+    explicit HashTableStoredHash(size_t) {
+    }
+};
+
+/*
+ * HashTableIsTransparent:
+ * - True when the functor declares is_transparent, i.e. it accepts other types than the key type.
+ *
+ * HashTableKeyArg:
+ * - Type of the key parameter of the lookup methods: any type K when both the hash and the key equality are
+ *   transparent, the key type otherwise.
+ */
+template<typename Functor, typename = void>
+struct HashTableIsTransparent : std::false_type {
+};
+
+template<typename Functor>
+struct HashTableIsTransparent<Functor, std::void_t<typename Functor::is_transparent> > : std::true_type {
+};
+
+template<bool Transparent>
+struct HashTableKeyArg {
+    template<typename K, typename Key>
+    using Type = Key;
+};
+
+template<>
+struct HashTableKeyArg<true> {
+    template<typename K, typename Key>
+    using Type = K;
+};
+
+/*
+ * TransparentStringHash:
+ * - Transparent hash for std::string keys. std::string, std::string_view and const char * are all hashed as a
+ *   std::string_view, which the standard guarantees to give the same value as std::hash<std::string>.
+ *   Use it together with std::equal_to<> as HashTable<std::string, Value, TransparentStringHash, std::equal_to<> >.
+ */
+struct TransparentStringHash {
+    using is_transparent = void;
+
+    size_t operator()(const std::string_view key) const {
+        return std::hash<std::string_view>()(key);
+    }
+};
+
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key>,
+    bool StoreHash = !std::is_arithmetic_v<Key> >
 class HashTable {
-    struct Node {
+    struct Node : HashTableStoredHash<StoreHash> {
         Key key;
         Value value;
-        std::unique_ptr<Node> next;
+        Node *next;
 
-        Node(Key key, Value value, std::unique_ptr<Node> next)
-            : key(key), value(value), next(std::move(next)) {
+        template<typename K, typename... Args>
+        explicit Node(Node *next, size_t hash, K &&key, Args &&... args)
+            : HashTableStoredHash<StoreHash>(hash), key(std::forward<K>(key)), value(std::forward<Args>(args)...),
+              next(next) {
         }
     };
 
-    std::vector<std::unique_ptr<Node> > buckets;
+    // Number of old buckets moved by every operation during an incremental resize.
+    static constexpr size_t kRehashStep = 4;
+    // Number of keys whose buckets are prefetched together by the batched operations.
+    static constexpr size_t kPrefetchBatch = 32;
+    // Default length of a chain that makes an insertion re-seed a reseedable hash.
+    static constexpr size_t kMaxChainLength = 16;
+    // Smallest number of pairs worth a thread of its own in BuildFrom and MergeFrom.
+    static constexpr size_t kParallelGrain = 4096;
+
+    static constexpr bool kTransparent =
+            HashTableIsTransparent<Hash>::value && HashTableIsTransparent<KeyEqual>::value;
+
+    template<typename K>
+    using KeyArg = typename HashTableKeyArg<kTransparent>::template Type<K, Key>;
+
+    std::vector<Node *> buckets;
+    std::vector<Node *> old_buckets;
+    NodePool<Node> pool;
+    Hash hasher;
+    KeyEqual key_equal;
+    size_t rehash_index = 0;
     size_t table_size;
     size_t element_count;
     float load_refactor = 0.75;
+    float growth_factor = 2.0;
+    bool incremental_resize = false;
+    // Set by the first InsertMulti: from then on MergeFrom keeps every pair of a key instead of replacing them.
+    bool multimap = false;
+    size_t resize_count = 0;
+    size_t max_chain_length = kMaxChainLength;
+    size_t reseed_count = 0;
+    // Number of pairs the table must hold before the next re-seed, so hostile keys can not make every insert re-seed.
+    size_t next_reseed_size = 0;
+    // Present with and without HASHTABLE_ENABLE_COUNTERS, so the layout of the class does not depend on the macro.
+    mutable HashTableCounters counters;
+
+    void RecordLookup(size_t first_comparison, bool found) const;
 
     void CopyBuckets(const HashTable &hash_table);
 
+    void CopyChains(const std::vector<Node *> &from, std::vector<Node *> &to);
+
+    void DestroyNodes();
+
+    [[nodiscard]] static size_t IndexFor(size_t hash, size_t bucket_count);
+
+    [[nodiscard]] static size_t StoredHash(const Node *node);
+
+    [[nodiscard]] size_t NodeHash(const Node *node) const;
+
+    template<typename K>
+    [[nodiscard]] bool Matches(const Node *node, size_t hash, const K &key) const;
+
+    template<typename K>
+    [[nodiscard]] bool SameKey(const Node *node, size_t hash, const K &key) const;
+
+    template<typename Function>
+    static std::exception_ptr RunTasks(size_t task_count, Function function);
+
+    Node *&BucketFor(size_t hash);
+
+    void MoveChain(Node *&bucket);
+
+    void RehashStep();
+
+    void FinishRehash();
+
+    void Rehash(size_t new_size, bool incremental);
+
+    [[nodiscard]] size_t BucketCountFor(size_t count) const;
+
+    void Reseed();
+
+    template<typename K, typename... Args>
+    std::pair<Node *, bool> TryEmplaceNode(K &&key, Args &&... args);
+
+    template<typename K, typename... Args>
+    Node *EmplaceMultiNode(K &&key, Args &&... args);
+
+    static void Prefetch(const void *address);
+
+    template<typename KeyOf>
+    void PrefetchBuckets(size_t count, KeyOf key_of, size_t hashes[], Node **bucket_refs[]);
+
+    void FindMany(const Key *keys, size_t count, Node *found[]);
+
+    /*
+    * Iterator class:
+    * - Iterator: Forward traversal over all key-value pairs, bucket by bucket and along every chain.
+    *   - bool operator!=(const Iterator &other) const: Checks if two iterators point to different nodes.
+    *   - Iterator &operator++(): Advances the iterator to the next key-value pair.
+    *   - Iterator operator++(int): Advances the iterator and returns a copy of the previous iterator.
+    *   - Entry operator*() const: Returns the key and a reference to the value of the current pair.
+    *   - EntryPointer operator->() const: Provides access to the key and the value as it->key and it->value.
+    *
+    */
 public:
+    struct Entry {
+        const Key &key;
+        Value &value;
+    };
+
+    class Iterator {
+        Node *const *bucket;
+        Node *const *bucket_end;
+        Node *node;
+
+        void SkipEmptyBuckets();
+
+    public:
+        struct EntryPointer {
+            Entry entry;
+
+            const Entry *operator->() const {
+                return &entry;
+            }
+        };
+
+        Iterator(Node *const *bucket, Node *const *bucket_end, Node *node);
+
+        bool operator!=(const Iterator &other) const;
+
+        bool operator==(const Iterator &other) const;
+
+        Iterator &operator++();
+
+        Iterator operator++(int);
+
+        Entry operator*() const;
+
+        EntryPointer operator->() const;
+    };
+
     // --- Constructors ---
-    explicit HashTable(size_t table_size = 16, float load_factor = 0.75);
+    explicit HashTable(size_t table_size = 16, float load_factor = 0.75, const Hash &hash = Hash(),
+                       const KeyEqual &equal = KeyEqual());
 
     HashTable(const HashTable &other);
 
@@ -87,21 +421,65 @@ public:
     ~HashTable();
 
     // Get Hash Function for Index
-    [[nodiscard]] int HashFunction(const Key &key) const;
+    [[nodiscard]] size_t HashFunction(const Key &key) const;
 
     // --- Add element ---
     void Insert(const Key &key, const Value &value);
 
+    void Insert(Key &&key, Value &&value);
+
+    template<typename... Args>
+    Value &Emplace(const Key &key, Args &&... args);
+
+    template<typename... Args>
+    Value &Emplace(Key &&key, Args &&... args);
+
+    template<typename... Args>
+    bool TryEmplace(const Key &key, Args &&... args);
+
+    template<typename... Args>
+    bool TryEmplace(Key &&key, Args &&... args);
+
+    template<typename V>
+    bool InsertOrAssign(const Key &key, V &&value);
+
+    template<typename V>
+    bool InsertOrAssign(Key &&key, V &&value);
+
+    void InsertMany(const std::vector<std::pair<Key, Value> > &entries);
+
+    Value &InsertMulti(const Key &key, const Value &value);
+
+    Value &InsertMulti(Key &&key, Value &&value);
+
+    Value &Increment(const Key &key, const Value &delta = Value(1));
+
     // --- Get element ---
-    Value &Get(const Key &key);
+    template<typename K = Key>
+    Value &Get(const KeyArg<K> &key);
+
+    template<typename K = Key>
+    Value *Find(const KeyArg<K> &key);
+
+    std::vector<Value *> GetMany(const std::vector<Key> &keys);
+
+    template<typename K = Key>
+    size_t Count(const KeyArg<K> &key);
+
+    template<typename K = Key>
+    std::pair<Iterator, Iterator> EqualRange(const KeyArg<K> &key);
 
     // --- Remove element ---
-    void Remove(Key &key);
+    template<typename K = Key>
+    void Remove(const KeyArg<K> &key);
 
     void Clear();
 
     // --- Find element ---
-    bool ContainsKey(const Key &key);
+    template<typename K = Key>
+    bool ContainsKey(const KeyArg<K> &key);
+
+    std::vector<bool> ContainsMany(const std::vector<Key> &keys);
 
     [[nodiscard]] bool IsEmpty() const;
 
@@ -111,206 +489,1362 @@ public:
     // --- Change size in hash table ---
     void Resize();
 
+    void Reserve(size_t count);
+
+    void ShrinkToFit();
+
+    void SetGrowthFactor(float factor);
+
+    void SetMaxLoadFactor(float load_factor);
+
+    void SetMaxChainLength(size_t length);
+
+    [[nodiscard]] float GrowthFactor() const;
+
+    [[nodiscard]] float MaxLoadFactor() const;
+
+    [[nodiscard]] size_t BucketCount() const;
+
+    [[nodiscard]] HashTableStats Stats() const;
+
+    void SetIncrementalResize(bool enabled);
+
+    [[nodiscard]] bool IsResizing() const;
+
+    // --- Traversal ---
+    Iterator Begin();
+
+    Iterator End();
+
+    Iterator begin();
+
+    Iterator end();
+
+    template<typename Function>
+    void ParallelForEach(Function function, unsigned thread_count = 0);
+
+    // --- Parallel bulk operations ---
+    template<typename Range>
+    void BuildFrom(const Range &range, unsigned thread_count = 0);
+
+    void MergeFrom(HashTable &&other, unsigned thread_count = 0);
+
+    // --- Snapshots ---
+    void SaveSnapshot(const std::string &path) const;
+
+    static HashTable LoadSnapshot(const std::string &path, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual());
+
     // --- Show hash table value ---
     void Show() const;
 };
 
-template<typename Key, typename Value>
-void HashTable<Key, Value>::CopyBuckets(const HashTable &hash_table) {
-    for (int i = 0; i < hash_table.table_size; ++i) {
-        Node *current = hash_table.buckets[i].get();
-        Node *previous = nullptr;
-        while (current != nullptr) {
-            auto newNode = std::make_unique<Node>(current->key, current->value, nullptr);
-            if (previous == nullptr) {
-                buckets[i] = std::move(newNode);
-            } else {
-                previous->next = std::move(newNode);
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::CopyBuckets(const HashTable &hash_table) {
+    buckets.assign(hash_table.buckets.size(), nullptr);
+    CopyChains(hash_table.buckets, buckets);
+    old_buckets.assign(hash_table.old_buckets.size(), nullptr);
+    CopyChains(hash_table.old_buckets, old_buckets);
+    rehash_index = hash_table.rehash_index;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::CopyChains(const std::vector<Node *> &from,
+                                                                  std::vector<Node *> &to) {
+    for (size_t i = 0; i < from.size(); ++i) {
+        Node **tail = &to[i];
+        for (Node *current = from[i]; current != nullptr; current = current->next) {
+            *tail = pool.Create(nullptr, StoredHash(current), current->key, current->value);
+            tail = &(*tail)->next;
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::DestroyNodes() {
+    // The slabs are released as a whole, the chains only have to be walked to run the destructors.
+    if constexpr (!std::is_trivially_destructible_v<Key> || !std::is_trivially_destructible_v<Value>) {
+        for (auto *bucket_array: {&buckets, &old_buckets}) {
+            for (Node *current: *bucket_array) {
+                while (current != nullptr) {
+                    Node *next = current->next;
+                    current->~Node();
+                    current = next;
+                }
             }
-            previous = previous == nullptr ? hash_table.buckets[i].get() : previous->next.get();
-            current = current->next.get();
         }
     }
+    pool.Release();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+size_t HashTable<Key, Value, Hash, KeyEqual, StoreHash>::IndexFor(const size_t hash, const size_t bucket_count) {
+    // Power-of-two bucket counts take the low bits with a mask instead of a division. The low bits of std::hash are
+    // poor for integers, so the hash is mixed first.
+    if ((bucket_count & (bucket_count - 1)) == 0) {
+        return MixHash(hash) & (bucket_count - 1);
+    }
+    return hash % bucket_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+size_t HashTable<Key, Value, Hash, KeyEqual, StoreHash>::StoredHash(const Node *node) {
+    if constexpr (StoreHash) {
+        return node->hash;
+    } else {
+        return 0;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+size_t HashTable<Key, Value, Hash, KeyEqual, StoreHash>::NodeHash(const Node *node) const {
+    if constexpr (StoreHash) {
+        return node->hash;
+    } else {
+        return hasher(node->key);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Matches(const Node *node, const size_t hash, const K &key) const {
+    HASHTABLE_COUNT(++counters.comparisons;)
+    return SameKey(node, hash, key);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::SameKey(const Node *node, const size_t hash, const K &key) const {
+    if constexpr (StoreHash) {
+        if (node->hash != hash) {
+            return false;
+        }
+    }
+    return key_equal(node->key, key);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Node *&
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::BucketFor(const size_t hash) {
+    if (!old_buckets.empty()) {
+        size_t old_index = IndexFor(hash, old_buckets.size());
+        if (old_index >= rehash_index) {
+            return old_buckets[old_index];
+        }
+    }
+    return buckets[IndexFor(hash, table_size)];
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::MoveChain(Node *&bucket) {
+    while (bucket != nullptr) {
+        Node *current = bucket;
+        bucket = current->next;
+        size_t new_index = IndexFor(NodeHash(current), table_size);
+        current->next = buckets[new_index];
+        buckets[new_index] = current;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::RehashStep() {
+    for (size_t moved = 0; moved < kRehashStep && rehash_index < old_buckets.size(); ++moved) {
+        MoveChain(old_buckets[rehash_index++]);
+    }
+    if (rehash_index == old_buckets.size()) {
+        std::vector<Node *>().swap(old_buckets);
+        rehash_index = 0;
+    }
 }
 
-template<typename Key, typename Value>
-HashTable<Key, Value>::HashTable(size_t table_size, const float load_factor)
-    : table_size(table_size), element_count(0), load_refactor(load_factor) {
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::FinishRehash() {
+    while (rehash_index < old_buckets.size()) {
+        MoveChain(old_buckets[rehash_index++]);
+    }
+    std::vector<Node *>().swap(old_buckets);
+    rehash_index = 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::HashTable(size_t table_size, const float load_factor, const Hash &hash,
+                                                            const KeyEqual &equal)
+    : hasher(hash), key_equal(equal), table_size(table_size), element_count(0), load_refactor(load_factor) {
     buckets.resize(table_size);
 }
 
-template<typename Key, typename Value>
-HashTable<Key, Value>::HashTable(const HashTable &other)
-    : buckets(other.table_size), table_size(other.table_size), element_count(other.element_count),
-      load_refactor(other.load_refactor) {
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::HashTable(const HashTable &other)
+    : hasher(other.hasher), key_equal(other.key_equal), table_size(other.table_size),
+      element_count(other.element_count), load_refactor(other.load_refactor), growth_factor(other.growth_factor),
+      incremental_resize(other.incremental_resize), multimap(other.multimap), max_chain_length(other.max_chain_length) {
     CopyBuckets(other);
 }
 
-template<typename Key, typename Value>
-HashTable<Key, Value>::HashTable(HashTable &&other) noexcept
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::HashTable(HashTable &&other) noexcept
     : buckets(std::move(other.buckets)),
+      old_buckets(std::move(other.old_buckets)),
+      pool(std::move(other.pool)),
+      hasher(std::move(other.hasher)),
+      key_equal(std::move(other.key_equal)),
+      rehash_index(other.rehash_index),
       table_size(other.table_size),
       element_count(other.element_count),
-      load_refactor(other.load_refactor) {
+      load_refactor(other.load_refactor),
+      growth_factor(other.growth_factor),
+      incremental_resize(other.incremental_resize),
+      multimap(other.multimap),
+      max_chain_length(other.max_chain_length) {
+    // The moved-from table keeps its load factor and growth policy, so it grows normally if it is used again.
+    other.rehash_index = 0;
     other.table_size = 0;
     other.element_count = 0;
-    other.load_refactor = 0.0;
 }
 
-template<typename Key, typename Value>
-HashTable<Key, Value> &HashTable<Key, Value>::operator=(const HashTable &other) {
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash> &
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::operator=(const HashTable &other) {
     if (this != &other) {
         Clear();
+        hasher = other.hasher;
+        key_equal = other.key_equal;
         table_size = other.table_size;
         element_count = other.element_count;
         load_refactor = other.load_refactor;
+        growth_factor = other.growth_factor;
+        incremental_resize = other.incremental_resize;
+        multimap = other.multimap;
+        max_chain_length = other.max_chain_length;
         CopyBuckets(other);
     }
     return *this;
 }
 
-template<typename Key, typename Value>
-HashTable<Key, Value> &HashTable<Key, Value>::operator=(HashTable &&other) noexcept {
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash> &
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::operator=(HashTable &&other) noexcept {
     if (this != &other) {
         Clear();
         buckets = std::move(other.buckets);
+        old_buckets = std::move(other.old_buckets);
+        pool = std::move(other.pool);
+        hasher = std::move(other.hasher);
+        key_equal = std::move(other.key_equal);
+        rehash_index = other.rehash_index;
         table_size = other.table_size;
         element_count = other.element_count;
         load_refactor = other.load_refactor;
+        growth_factor = other.growth_factor;
+        incremental_resize = other.incremental_resize;
+        multimap = other.multimap;
+        max_chain_length = other.max_chain_length;
 
+        other.rehash_index = 0;
         other.table_size = 0;
         other.element_count = 0;
-        other.load_refactor = 0.0f;
         other.buckets.clear();
+        other.old_buckets.clear();
     }
     return *this;
 }
 
-template<typename Key, typename Value>
-HashTable<Key, Value>::~HashTable() {
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::~HashTable() {
     Clear();
 }
 
-template<typename Key, typename Value>
-int HashTable<Key, Value>::HashFunction(const Key &key) const {
-    std::hash<Key> hash;
-    return hash(key) % table_size;
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+size_t HashTable<Key, Value, Hash, KeyEqual, StoreHash>::HashFunction(const Key &key) const {
+    return IndexFor(hasher(key), table_size);
 }
 
-// add check
-template<typename Key, typename Value>
-void HashTable<Key, Value>::Insert(const Key &key, const Value &value) {
-    if (element_count >= table_size * load_refactor) {
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K, typename... Args>
+std::pair<typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Node *, bool>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::TryEmplaceNode(K &&key, Args &&... args) {
+    if (!old_buckets.empty()) {
+        RehashStep();
+    } else if (element_count >= table_size * load_refactor) {
         Resize();
     }
-    int hash = HashFunction(key);
-    auto &bucket = buckets[hash];
-    Node *current = bucket.get();
+    const size_t hash = hasher(key);
+    Node *&bucket = BucketFor(hash);
+    Node *current = bucket;
+    size_t chain_length = 1;
 
     while (current != nullptr) {
-        if (current->key == key) {
-            current->value = value;
-            return;
+        if (Matches(current, hash, key)) {
+            return {current, false};
+        }
+        current = current->next;
+        ++chain_length;
+    }
+
+    Node *node = pool.Create(bucket, hash, std::forward<K>(key), std::forward<Args>(args)...);
+    bucket = node;
+    ++element_count;
+    HASHTABLE_COUNT(++counters.inserts;)
+    if constexpr (HashTableIsReseedable<Hash>::value) {
+        if (chain_length > max_chain_length && element_count >= next_reseed_size) {
+            Reseed();
         }
-        current = current->next.get();
     }
+    return {node, true};
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K, typename... Args>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Node *
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::EmplaceMultiNode(K &&key, Args &&... args) {
+    if (!old_buckets.empty()) {
+        RehashStep();
+    } else if (element_count >= table_size * load_refactor) {
+        Resize();
+    }
+    const size_t hash = hasher(key);
+    Node **link = &BucketFor(hash);
+    size_t chain_length = 1;
 
-    auto newNode = std::make_unique<Node>(key, value, std::move(bucket));
-    bucket = std::move(newNode);
+    // The new node goes in front of the first node with an equal key, so all pairs of a key stay contiguous.
+    while (*link != nullptr && !Matches(*link, hash, key)) {
+        link = &(*link)->next;
+        ++chain_length;
+    }
+
+    Node *node = pool.Create(*link, hash, std::forward<K>(key), std::forward<Args>(args)...);
+    *link = node;
     ++element_count;
+    multimap = true;
+    HASHTABLE_COUNT(++counters.inserts;)
+    if constexpr (HashTableIsReseedable<Hash>::value) {
+        // Only the nodes of other keys are counted: a new seed can not split a run of equal keys.
+        if (chain_length > max_chain_length && element_count >= next_reseed_size) {
+            Reseed();
+        }
+    }
+    return node;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Insert(const Key &key, const Value &value) {
+    InsertOrAssign(key, value);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Insert(Key &&key, Value &&value) {
+    InsertOrAssign(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename... Args>
+Value &HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Emplace(const Key &key, Args &&... args) {
+    auto [node, inserted] = TryEmplaceNode(key, std::forward<Args>(args)...);
+    if (!inserted) {
+        node->value = Value(std::forward<Args>(args)...);
+    }
+    return node->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename... Args>
+Value &HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Emplace(Key &&key, Args &&... args) {
+    auto [node, inserted] = TryEmplaceNode(std::move(key), std::forward<Args>(args)...);
+    if (!inserted) {
+        node->value = Value(std::forward<Args>(args)...);
+    }
+    return node->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename... Args>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::TryEmplace(const Key &key, Args &&... args) {
+    return TryEmplaceNode(key, std::forward<Args>(args)...).second;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename... Args>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::TryEmplace(Key &&key, Args &&... args) {
+    return TryEmplaceNode(std::move(key), std::forward<Args>(args)...).second;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename V>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::InsertOrAssign(const Key &key, V &&value) {
+    auto [node, inserted] = TryEmplaceNode(key, std::forward<V>(value));
+    if (!inserted) {
+        node->value = std::forward<V>(value);
+    }
+    return inserted;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename V>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::InsertOrAssign(Key &&key, V &&value) {
+    auto [node, inserted] = TryEmplaceNode(std::move(key), std::forward<V>(value));
+    if (!inserted) {
+        node->value = std::forward<V>(value);
+    }
+    return inserted;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+Value &HashTable<Key, Value, Hash, KeyEqual, StoreHash>::InsertMulti(const Key &key, const Value &value) {
+    return EmplaceMultiNode(key, value)->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+Value &HashTable<Key, Value, Hash, KeyEqual, StoreHash>::InsertMulti(Key &&key, Value &&value) {
+    return EmplaceMultiNode(std::move(key), std::move(value))->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+Value &HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Increment(const Key &key, const Value &delta) {
+    // One probe: a missing key is inserted with delta itself, a present one is updated in its node.
+    auto [node, inserted] = TryEmplaceNode(key, delta);
+    if (!inserted) {
+        node->value += delta;
+    }
+    return node->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Prefetch(const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void) address;
+#endif
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename KeyOf>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::PrefetchBuckets(const size_t count, KeyOf key_of, size_t hashes[],
+                                                                       Node **bucket_refs[]) {
+    // First hash the whole batch and prefetch the bucket slots, then load the bucket heads and prefetch the first
+    // nodes. The chains are walked only after that, so the cache misses of all keys overlap.
+    for (size_t i = 0; i < count; ++i) {
+        hashes[i] = hasher(key_of(i));
+        bucket_refs[i] = &BucketFor(hashes[i]);
+        Prefetch(bucket_refs[i]);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (*bucket_refs[i] != nullptr) {
+            Prefetch(*bucket_refs[i]);
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::FindMany(const Key *keys, const size_t count, Node *found[]) {
+    if (table_size == 0) {
+        std::fill(found, found + count, nullptr);
+        return;
+    }
+    if (!old_buckets.empty()) {
+        RehashStep();
+    }
+    std::array<size_t, kPrefetchBatch> hashes;
+    std::array<Node **, kPrefetchBatch> bucket_refs;
+    for (size_t start = 0; start < count; start += kPrefetchBatch) {
+        const size_t batch = std::min(kPrefetchBatch, count - start);
+        PrefetchBuckets(batch, [keys, start](size_t i) -> const Key & { return keys[start + i]; }, hashes.data(),
+                        bucket_refs.data());
+        for (size_t i = 0; i < batch; ++i) {
+            HASHTABLE_COUNT(const size_t first_comparison = counters.comparisons;)
+            Node *current = *bucket_refs[i];
+            while (current != nullptr && !Matches(current, hashes[i], keys[start + i])) {
+                current = current->next;
+            }
+            HASHTABLE_COUNT(RecordLookup(first_comparison, current != nullptr);)
+            found[start + i] = current;
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::InsertMany(const std::vector<std::pair<Key, Value> > &entries) {
+    std::array<size_t, kPrefetchBatch> hashes;
+    std::array<Node **, kPrefetchBatch> bucket_refs;
+    for (size_t start = 0; start < entries.size(); start += kPrefetchBatch) {
+        const size_t batch = std::min(kPrefetchBatch, entries.size() - start);
+        // Grow before the batch, the prefetched bucket references must stay valid until it is inserted. The new size
+        // holds the whole batch below the load factor, and grows at least by growth_factor so that the batches that
+        // follow do not rehash again right away.
+        if (element_count + batch >= table_size * load_refactor) {
+            size_t grown = static_cast<size_t>(static_cast<double>(table_size) * growth_factor);
+            grown = table_size == 0 ? 16 : std::max(grown, table_size + 1);
+            Rehash(std::max(BucketCountFor(element_count + batch + 1), grown), incremental_resize);
+        } else if (!old_buckets.empty()) {
+            RehashStep();
+        }
+        PrefetchBuckets(batch, [&entries, start](size_t i) -> const Key & { return entries[start + i].first; },
+                        hashes.data(), bucket_refs.data());
+        bool long_chain = false;
+        for (size_t i = 0; i < batch; ++i) {
+            const auto &[key, value] = entries[start + i];
+            Node *&bucket = *bucket_refs[i];
+            Node *current = bucket;
+            size_t chain_length = 1;
+            while (current != nullptr && !Matches(current, hashes[i], key)) {
+                current = current->next;
+                ++chain_length;
+            }
+            if (current != nullptr) {
+                current->value = value;
+            } else {
+                bucket = pool.Create(bucket, hashes[i], key, value);
+                ++element_count;
+                HASHTABLE_COUNT(++counters.inserts;)
+                long_chain = long_chain || chain_length > max_chain_length;
+            }
+        }
+        // A re-seed relinks every node, so it waits until no bucket reference of the batch is in use any more.
+        if constexpr (HashTableIsReseedable<Hash>::value) {
+            if (long_chain && element_count >= next_reseed_size) {
+                Reseed();
+            }
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+std::vector<Value *> HashTable<Key, Value, Hash, KeyEqual, StoreHash>::GetMany(const std::vector<Key> &keys) {
+    std::vector<Node *> found(keys.size());
+    FindMany(keys.data(), keys.size(), found.data());
+    std::vector<Value *> values(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        values[i] = found[i] == nullptr ? nullptr : &found[i]->value;
+    }
+    return values;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+std::vector<bool> HashTable<Key, Value, Hash, KeyEqual, StoreHash>::ContainsMany(const std::vector<Key> &keys) {
+    std::vector<Node *> found(keys.size());
+    FindMany(keys.data(), keys.size(), found.data());
+    std::vector<bool> contains(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        contains[i] = found[i] != nullptr;
+    }
+    return contains;
 }
 
-template<typename Key, typename Value>
-Value &HashTable<Key, Value>::Get(const Key &key) {
-    int hash = HashFunction(key);
-    auto &bucket = buckets[hash];
-    Node *current = bucket.get();
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K>
+Value &HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Get(const KeyArg<K> &key) {
+    Value *value = Find<K>(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K>
+Value *HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Find(const KeyArg<K> &key) {
+    // A table created with no buckets, or moved from, has nothing to look in.
+    if (table_size == 0) {
+        return nullptr;
+    }
+    if (!old_buckets.empty()) {
+        RehashStep();
+    }
+    HASHTABLE_COUNT(const size_t first_comparison = counters.comparisons;)
+    const size_t hash = hasher(key);
+    Node *current = BucketFor(hash);
     while (current != nullptr) {
-        if (current->key == key) {
-            return current->value;
+        if (Matches(current, hash, key)) {
+            HASHTABLE_COUNT(RecordLookup(first_comparison, true);)
+            return &current->value;
         }
-        current = current->next.get();
+        current = current->next;
+    }
+    HASHTABLE_COUNT(RecordLookup(first_comparison, false);)
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K>
+size_t HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Count(const KeyArg<K> &key) {
+    if (table_size == 0) {
+        return 0;
+    }
+    if (!old_buckets.empty()) {
+        RehashStep();
     }
-    throw std::out_of_range("Incorrect key index!\n");
+    const size_t hash = hasher(key);
+    Node *current = BucketFor(hash);
+    while (current != nullptr && !Matches(current, hash, key)) {
+        current = current->next;
+    }
+    size_t count = 0;
+    while (current != nullptr && Matches(current, hash, key)) {
+        ++count;
+        current = current->next;
+    }
+    return count;
 }
 
-template<typename Key, typename Value>
-void HashTable<Key, Value>::Remove(Key &key) {
-    int hash = HashFunction(key);
-    auto &bucket = buckets[hash];
-    Node *current = bucket.get();
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K>
+std::pair<typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator,
+    typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::EqualRange(const KeyArg<K> &key) {
+    // The range is made of table iterators, which walk a single bucket array.
+    FinishRehash();
+    if (buckets.empty()) {
+        return {End(), End()};
+    }
+    const size_t hash = hasher(key);
+    Node *const *bucket = buckets.data() + IndexFor(hash, table_size);
+    Node *const *bucket_end = buckets.data() + buckets.size();
+    Node *first = *bucket;
+    while (first != nullptr && !Matches(first, hash, key)) {
+        first = first->next;
+    }
+    if (first == nullptr) {
+        return {End(), End()};
+    }
+    Node *last = first;
+    while (last->next != nullptr && Matches(last->next, hash, key)) {
+        last = last->next;
+    }
+    // An iterator past the run lands on the same node as advancing from its last pair, even in a later bucket.
+    return {Iterator(bucket, bucket_end, first), Iterator(bucket, bucket_end, last->next)};
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Remove(const KeyArg<K> &key) {
+    if (table_size == 0) {
+        throw std::out_of_range("No such key exists!\n");
+    }
+    if (!old_buckets.empty()) {
+        RehashStep();
+    }
+    const size_t hash = hasher(key);
+    Node *&bucket = BucketFor(hash);
+    Node *current = bucket;
     Node *previous = nullptr;
     while (current != nullptr) {
-        if (current->key == key) {
+        if (Matches(current, hash, key)) {
             if (previous == nullptr) {
-                bucket = std::move(current->next);
+                bucket = current->next;
             } else {
-                previous->next = std::move(current->next);
+                previous->next = current->next;
             }
+            pool.Destroy(current);
             --element_count;
+            HASHTABLE_COUNT(++counters.removes;)
             return;
         }
         previous = current;
-        current = current->next.get();
+        current = current->next;
     }
     throw std::out_of_range("No such key exists!\n");
 }
 
-template<typename Key, typename Value>
-void HashTable<Key, Value>::Clear() {
-    buckets.clear();
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Clear() {
+    DestroyNodes();
+    std::fill(buckets.begin(), buckets.end(), nullptr);
+    std::vector<Node *>().swap(old_buckets);
+    rehash_index = 0;
     element_count = 0;
 }
 
-template<typename Key, typename Value>
-bool HashTable<Key, Value>::ContainsKey(const Key &key) {
-    int hash = HashFunction(key);
-    auto &bucket = buckets[hash];
-    Node *current = bucket.get();
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename K>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::ContainsKey(const KeyArg<K> &key) {
+    if (table_size == 0) {
+        return false;
+    }
+    if (!old_buckets.empty()) {
+        RehashStep();
+    }
+    HASHTABLE_COUNT(const size_t first_comparison = counters.comparisons;)
+    const size_t hash = hasher(key);
+    Node *current = BucketFor(hash);
     while (current != nullptr) {
-        if (current->key == key) {
+        if (Matches(current, hash, key)) {
+            HASHTABLE_COUNT(RecordLookup(first_comparison, true);)
             return true;
         }
-        current = current->next.get();
+        current = current->next;
     }
+    HASHTABLE_COUNT(RecordLookup(first_comparison, false);)
     return false;
 }
 
-template<typename Key, typename Value>
-bool HashTable<Key, Value>::IsEmpty() const {
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::IsEmpty() const {
     return element_count == 0;
 }
 
-template<typename Key, typename Value>
-size_t HashTable<Key, Value>::Size() const {
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+size_t HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Size() const {
     return element_count;
 }
 
-template<typename Key, typename Value>
-void HashTable<Key, Value>::Resize() {
-    size_t new_size = table_size * 2;
-    std::vector<std::unique_ptr<Node> > new_buckets(new_size);
-    for (auto &bucket: buckets) {
-        while (bucket) {
-            auto current = std::move(bucket);
-            bucket = std::move(current->next);
-            size_t new_index = HashFunction(current->key);
-            current->next = std::move(new_buckets[new_index]);
-            new_buckets[new_index] = std::move(current);
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Rehash(const size_t new_size, const bool incremental) {
+    FinishRehash();
+    ++resize_count;
+    old_buckets = std::move(buckets);
+    buckets = std::vector<Node *>(new_size, nullptr);
+    table_size = new_size;
+    rehash_index = 0;
+    if (!incremental) {
+        FinishRehash();
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+size_t HashTable<Key, Value, Hash, KeyEqual, StoreHash>::BucketCountFor(const size_t count) const {
+    size_t size = std::max<size_t>(1, static_cast<size_t>(std::ceil(static_cast<double>(count) / load_refactor)));
+    if ((table_size & (table_size - 1)) == 0) {
+        // Keep a power-of-two table in the mask mode.
+        size_t power = 1;
+        while (power < size) {
+            power *= 2;
+        }
+        size = power;
+    }
+    return size;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Reseed() {
+    FinishRehash();
+    hasher.Reseed(RandomSeed());
+    std::vector<Node *> new_buckets(table_size, nullptr);
+    for (Node *bucket: buckets) {
+        while (bucket != nullptr) {
+            Node *next = bucket->next;
+            const size_t hash = hasher(bucket->key);
+            if constexpr (StoreHash) {
+                bucket->hash = hash;
+            }
+            Node *&new_bucket = new_buckets[IndexFor(hash, table_size)];
+            bucket->next = new_bucket;
+            new_bucket = bucket;
+            bucket = next;
         }
     }
     buckets = std::move(new_buckets);
-    table_size = new_size;
+    ++reseed_count;
+    next_reseed_size = element_count * 2;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Resize() {
+    size_t new_size = static_cast<size_t>(static_cast<double>(table_size) * growth_factor);
+    new_size = table_size == 0 ? 16 : std::max(new_size, table_size + 1);
+    Rehash(new_size, incremental_resize);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Reserve(const size_t count) {
+    const size_t new_size = BucketCountFor(count + 1);
+    if (new_size > table_size) {
+        Rehash(new_size, false);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::ShrinkToFit() {
+    const size_t new_size = BucketCountFor(element_count + 1);
+    if (new_size < table_size) {
+        Rehash(new_size, false);
+    }
+    FinishRehash();
+    buckets.shrink_to_fit();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::SetGrowthFactor(const float factor) {
+    if (factor <= 1.0f) {
+        throw std::invalid_argument("Growth factor must be greater than 1!\n");
+    }
+    growth_factor = factor;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::SetMaxLoadFactor(const float load_factor) {
+    if (load_factor <= 0.0f) {
+        throw std::invalid_argument("Load factor must be positive!\n");
+    }
+    load_refactor = load_factor;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::SetMaxChainLength(const size_t length) {
+    max_chain_length = length;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+float HashTable<Key, Value, Hash, KeyEqual, StoreHash>::GrowthFactor() const {
+    return growth_factor;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+float HashTable<Key, Value, Hash, KeyEqual, StoreHash>::MaxLoadFactor() const {
+    return load_refactor;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+size_t HashTable<Key, Value, Hash, KeyEqual, StoreHash>::BucketCount() const {
+    return table_size;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTableStats HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Stats() const {
+    HashTableStats stats;
+    stats.element_count = element_count;
+    stats.resize_count = resize_count;
+    stats.reseed_count = reseed_count;
+    stats.bytes_used = sizeof(*this) + (buckets.capacity() + old_buckets.capacity()) * sizeof(Node *) +
+                       pool.BytesUsed();
+    size_t empty_buckets = 0;
+    size_t successful_comparisons = 0;
+    auto add_bucket = [&](const Node *bucket) {
+        size_t length = 0;
+        for (; bucket != nullptr; bucket = bucket->next) {
+            ++length;
+        }
+        if (stats.chain_length_histogram.size() <= length) {
+            stats.chain_length_histogram.resize(length + 1);
+        }
+        ++stats.chain_length_histogram[length];
+        stats.max_chain_length = std::max(stats.max_chain_length, length);
+        empty_buckets += length == 0;
+        // The i-th node of a chain is found after i comparisons.
+        successful_comparisons += length * (length + 1) / 2;
+        ++stats.bucket_count;
+    };
+    for (const Node *bucket: buckets) {
+        add_bucket(bucket);
+    }
+    for (size_t i = rehash_index; i < old_buckets.size(); ++i) {
+        add_bucket(old_buckets[i]);
+    }
+    if (stats.bucket_count != 0) {
+        stats.empty_bucket_ratio = static_cast<double>(empty_buckets) / stats.bucket_count;
+        stats.expected_unsuccessful_comparisons = static_cast<double>(element_count) / stats.bucket_count;
+    }
+    if (element_count != 0) {
+        stats.expected_successful_comparisons = static_cast<double>(successful_comparisons) / element_count;
+    }
+#ifdef HASHTABLE_ENABLE_COUNTERS
+    stats.counters_enabled = true;
+    stats.counters = counters;
+#endif
+    return stats;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::RecordLookup(const size_t first_comparison, const bool found) const {
+    if (found) {
+        ++counters.successful_lookups;
+        counters.successful_comparisons += counters.comparisons - first_comparison;
+    } else {
+        ++counters.unsuccessful_lookups;
+        counters.unsuccessful_comparisons += counters.comparisons - first_comparison;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::SetIncrementalResize(const bool enabled) {
+    incremental_resize = enabled;
+    if (!enabled) {
+        FinishRehash();
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::IsResizing() const {
+    return !old_buckets.empty();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::SkipEmptyBuckets() {
+    while (node == nullptr && bucket != bucket_end && ++bucket != bucket_end) {
+        node = *bucket;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::Iterator(Node *const *bucket, Node *const *bucket_end, Node *node)
+    : bucket(bucket), bucket_end(bucket_end), node(node) {
+    SkipEmptyBuckets();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::operator!=(const Iterator &other) const {
+    return node != other.node;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+bool HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::operator==(const Iterator &other) const {
+    return node == other.node;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator &HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::operator++() {
+    node = node->next;
+    SkipEmptyBuckets();
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::operator++(int) {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
 }
 
-template<typename Key, typename Value>
-void HashTable<Key, Value>::Show() const {
-    for (int i = 0; i < table_size; ++i) {
-        Node *current = buckets[i].get();
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Entry HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::operator*() const {
+    return {node->key, node->value};
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::EntryPointer HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator::operator->() const {
+    return {{node->key, node->value}};
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Begin() {
+    // Iteration walks a single bucket array, so a pending incremental resize is completed first.
+    FinishRehash();
+    if (buckets.empty()) {
+        return End();
+    }
+    return Iterator(buckets.data(), buckets.data() + buckets.size(), buckets.front());
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator HashTable<Key, Value, Hash, KeyEqual, StoreHash>::End() {
+    return Iterator(nullptr, nullptr, nullptr);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator HashTable<Key, Value, Hash, KeyEqual, StoreHash>::begin() {
+    return Begin();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+typename HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Iterator HashTable<Key, Value, Hash, KeyEqual, StoreHash>::end() {
+    return End();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename Function>
+std::exception_ptr HashTable<Key, Value, Hash, KeyEqual, StoreHash>::RunTasks(const size_t task_count,
+                                                                              Function function) {
+    std::vector<std::exception_ptr> errors(task_count);
+    auto run = [&function, &errors](const size_t task) {
+        try {
+            function(task);
+        } catch (...) {
+            errors[task] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    size_t task = 1;
+    try {
+        threads.reserve(task_count - 1);
+        for (; task < task_count; ++task) {
+            threads.emplace_back(run, task);
+        }
+    } catch (...) {
+        // No more threads could be started (std::system_error) or tracked (std::bad_alloc). The threads that run
+        // are joined below, and the calling thread takes over the tasks that are left.
+    }
+    for (; task < task_count; ++task) {
+        run(task);
+    }
+    run(0);
+    for (auto &thread: threads) {
+        thread.join();
+    }
+    for (const auto &error: errors) {
+        if (error) {
+            return error;
+        }
+    }
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename Function>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::ParallelForEach(Function function, unsigned thread_count) {
+    FinishRehash();
+    if (thread_count == 0) {
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    // Every thread gets a contiguous range of buckets, and the calling thread takes the first one.
+    const size_t range_count = std::max<size_t>(1, std::min<size_t>(thread_count, buckets.size()));
+    const size_t range_size = (buckets.size() + range_count - 1) / range_count;
+    const std::exception_ptr error = RunTasks(range_count, [this, &function, range_size](const size_t range) {
+        const size_t last = std::min((range + 1) * range_size, buckets.size());
+        for (size_t i = range * range_size; i < last; ++i) {
+            for (Node *current = buckets[i]; current != nullptr; current = current->next) {
+                function(static_cast<const Key &>(current->key), current->value);
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+template<typename Range>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::BuildFrom(const Range &range, unsigned thread_count) {
+    const auto first = std::begin(range);
+    const size_t count = static_cast<size_t>(std::distance(first, std::end(range)));
+    if (count == 0) {
+        return;
+    }
+    FinishRehash();
+    Reserve(element_count + count);
+    if (thread_count == 0) {
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    const size_t task_count = std::max<size_t>(1, std::min({static_cast<size_t>(thread_count), buckets.size(),
+                                                            count / kParallelGrain}));
+    const size_t range_size = (buckets.size() + task_count - 1) / task_count;
+    const size_t slice_size = (count + task_count - 1) / task_count;
+
+    // Pass 1: every task hashes a slice of the input and counts the pairs of every bucket range.
+    std::vector<size_t> hashes(count);
+    std::vector<size_t> offsets(task_count * task_count + 1, 0);
+    std::exception_ptr error = RunTasks(task_count, [&, first](const size_t slice) {
+        const size_t last = std::min((slice + 1) * slice_size, count);
+        for (size_t i = slice * slice_size; i < last; ++i) {
+            hashes[i] = hasher(first[i].first);
+            ++offsets[IndexFor(hashes[i], table_size) / range_size * task_count + slice + 1];
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    // Counts ordered by (range, slice): after the prefix sum every slice owns a disjoint part of every range.
+    for (size_t i = 1; i < offsets.size(); ++i) {
+        offsets[i] += offsets[i - 1];
+    }
+    std::vector<size_t> order(count);
+    error = RunTasks(task_count, [&](const size_t slice) {
+        std::vector<size_t> next(task_count);
+        for (size_t range_index = 0; range_index < task_count; ++range_index) {
+            next[range_index] = offsets[range_index * task_count + slice];
+        }
+        const size_t last = std::min((slice + 1) * slice_size, count);
+        for (size_t i = slice * slice_size; i < last; ++i) {
+            order[next[IndexFor(hashes[i], table_size) / range_size]++] = i;
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    // Pass 2: every task links the pairs of one bucket range, with nodes from a pool of its own.
+    std::vector<NodePool<Node> > pools(task_count);
+    std::vector<size_t> inserted(task_count, 0);
+    std::vector<char> long_chain(task_count, false);
+    error = RunTasks(task_count, [&, first](const size_t range_index) {
+        const size_t last = offsets[(range_index + 1) * task_count];
+        for (size_t i = offsets[range_index * task_count]; i < last; ++i) {
+            const auto &entry = first[order[i]];
+            const size_t hash = hashes[order[i]];
+            Node *&bucket = buckets[IndexFor(hash, table_size)];
+            Node *current = bucket;
+            size_t chain_length = 1;
+            while (current != nullptr && !SameKey(current, hash, entry.first)) {
+                current = current->next;
+                ++chain_length;
+            }
+            if (current != nullptr) {
+                current->value = entry.second;
+            } else {
+                bucket = pools[range_index].Create(bucket, hash, entry.first, entry.second);
+                ++inserted[range_index];
+                long_chain[range_index] = long_chain[range_index] || chain_length > max_chain_length;
+            }
+        }
+    });
+    // The nodes that were linked stay in the table even if a task failed.
+    for (size_t i = 0; i < task_count; ++i) {
+        pool.Absorb(std::move(pools[i]));
+        element_count += inserted[i];
+        HASHTABLE_COUNT(counters.inserts += inserted[i];)
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    // The tasks only note a chain that grew too long; the re-seed relinks all buckets, so it runs after them.
+    if constexpr (HashTableIsReseedable<Hash>::value) {
+        if (std::find(long_chain.begin(), long_chain.end(), true) != long_chain.end() &&
+            element_count >= next_reseed_size) {
+            Reseed();
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::MergeFrom(HashTable &&other, unsigned thread_count) {
+    if (this == &other || other.element_count == 0) {
+        return;
+    }
+    other.FinishRehash();
+    FinishRehash();
+    Reserve(element_count + other.element_count);
+    if (thread_count == 0) {
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    const size_t task_count = std::max<size_t>(1, std::min({static_cast<size_t>(thread_count), buckets.size(),
+                                                            other.buckets.size(),
+                                                            other.element_count / kParallelGrain}));
+    const size_t range_size = (buckets.size() + task_count - 1) / task_count;
+    const size_t slice_size = (other.buckets.size() + task_count - 1) / task_count;
+
+    // Pass 1: every task hashes the nodes of a range of buckets of other with the hash function of this table, and
+    // sorts them by the bucket range they go to. Nothing is relinked yet, so a failing hash leaves both tables intact.
+    std::vector<std::vector<std::pair<Node *, size_t> > > moves(task_count * task_count);
+    std::exception_ptr error = RunTasks(task_count, [&](const size_t slice) {
+        const size_t last = std::min((slice + 1) * slice_size, other.buckets.size());
+        for (size_t i = slice * slice_size; i < last; ++i) {
+            for (Node *current = other.buckets[i]; current != nullptr; current = current->next) {
+                const size_t hash = hasher(current->key);
+                moves[IndexFor(hash, table_size) / range_size * task_count + slice].emplace_back(current, hash);
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    // Pass 2: every task finds the runs of one bucket range and the nodes they join in this table. The pairs of other
+    // with equal keys are adjacent in its chains, so they arrive one after another in the same list and form one run.
+    // This pass makes every call to KeyEqual and still changes nothing, so a comparison that throws leaves both tables
+    // intact.
+    struct Run {
+        size_t list_index;
+        size_t begin;
+        size_t length;
+        // First and last node of the run with the same key that this table had before the merge, or nullptr.
+        Node *match;
+        Node *match_last;
+    };
+    const bool keep_all = multimap || other.multimap;
+    std::vector<std::vector<Run> > runs(task_count);
+    error = RunTasks(task_count, [&](const size_t range_index) {
+        for (size_t slice = 0; slice < task_count; ++slice) {
+            const size_t list_index = range_index * task_count + slice;
+            const auto &list = moves[list_index];
+            for (size_t i = 0; i < list.size();) {
+                const Key &key = list[i].first->key;
+                const size_t hash = list[i].second;
+                Run run{list_index, i, 1, buckets[IndexFor(hash, table_size)], nullptr};
+                for (++i; i < list.size() && list[i].second == hash && key_equal(list[i].first->key, key); ++i) {
+                    ++run.length;
+                }
+                while (run.match != nullptr && !SameKey(run.match, hash, key)) {
+                    run.match = run.match->next;
+                }
+                if (run.match != nullptr && !keep_all) {
+                    run.match_last = run.match;
+                    while (run.match_last->next != nullptr && SameKey(run.match_last->next, hash, key)) {
+                        run.match_last = run.match_last->next;
+                    }
+                }
+                runs[range_index].push_back(run);
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    // Pass 3: every task splices the runs of its range in front of the run they match, or at the end of the chain.
+    // A matched run of this table is cut out when pairs are replaced, and its nodes are destroyed afterwards. Only
+    // pointers are written here, so once this pass has started the merge can not fail.
+    std::vector<Node *> replaced(task_count, nullptr);
+    std::vector<size_t> linked(task_count, 0);
+    std::vector<size_t> removed(task_count, 0);
+    std::vector<char> long_chain(task_count, false);
+    RunTasks(task_count, [&](const size_t range_index) noexcept {
+        for (const Run &run: runs[range_index]) {
+            const auto &list = moves[run.list_index];
+            const size_t hash = list[run.begin].second;
+            Node *const first = list[run.begin].first;
+            Node *last = first;
+            for (size_t i = run.begin + 1; i < run.begin + run.length; ++i) {
+                last->next = list[i].first;
+                last = list[i].first;
+            }
+            if constexpr (StoreHash) {
+                for (size_t i = run.begin; i < run.begin + run.length; ++i) {
+                    list[i].first->hash = hash;
+                }
+            }
+            // The runs spliced in before this one may have changed which pointer leads to the match.
+            Node **link = &buckets[IndexFor(hash, table_size)];
+            size_t chain_length = 1;
+            while (*link != run.match) {
+                link = &(*link)->next;
+                ++chain_length;
+            }
+            long_chain[range_index] = long_chain[range_index] || chain_length > max_chain_length;
+            Node *rest = run.match;
+            if (run.match_last != nullptr) {
+                for (Node *node = run.match; node != run.match_last->next; node = node->next) {
+                    ++removed[range_index];
+                }
+                rest = run.match_last->next;
+                run.match_last->next = replaced[range_index];
+                replaced[range_index] = run.match;
+            }
+            last->next = rest;
+            *link = first;
+            linked[range_index] += run.length;
+        }
+    });
+    multimap = keep_all;
+    pool.Absorb(std::move(other.pool));
+    for (size_t i = 0; i < task_count; ++i) {
+        Node *node = replaced[i];
+        while (node != nullptr) {
+            Node *next = node->next;
+            pool.Destroy(node);
+            node = next;
+        }
+        element_count += linked[i] - removed[i];
+        HASHTABLE_COUNT(counters.inserts += linked[i] - removed[i];)
+    }
+    std::fill(other.buckets.begin(), other.buckets.end(), nullptr);
+    other.element_count = 0;
+    // As in BuildFrom, a chain that grew past the limit during the merge is only re-seeded once all tasks are
+    // done, and once other no longer points at the relinked nodes.
+    if constexpr (HashTableIsReseedable<Hash>::value) {
+        if (std::find(long_chain.begin(), long_chain.end(), true) != long_chain.end() &&
+            element_count >= next_reseed_size) {
+            Reseed();
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::SaveSnapshot(const std::string &path) const {
+    static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+                  "Snapshots hold trivially copyable keys and values only");
+    using Entry = HashTableSnapshotEntry<Key, Value>;
+    uint64_t bucket_count = 1;
+    while (bucket_count * 3 < element_count * 4) {
+        bucket_count *= 2;
+    }
+    auto for_each_node = [this](auto function) {
+        for (const Node *bucket: buckets) {
+            for (const Node *current = bucket; current != nullptr; current = current->next) {
+                function(current);
+            }
+        }
+        for (size_t i = rehash_index; i < old_buckets.size(); ++i) {
+            for (const Node *current = old_buckets[i]; current != nullptr; current = current->next) {
+                function(current);
+            }
+        }
+    };
+    // Counting sort of the entries by their snapshot bucket.
+    std::vector<uint64_t> offsets(bucket_count + 1, 0);
+    for_each_node([&](const Node *node) {
+        ++offsets[(MixHash(NodeHash(node)) & (bucket_count - 1)) + 1];
+    });
+    for (uint64_t i = 0; i < bucket_count; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+    std::vector<uint64_t> next(offsets.begin(), offsets.end() - 1);
+    // Zero-filled, so the padding bytes of the entries are deterministic.
+    std::unique_ptr<Entry[]> entries(new Entry[element_count]);
+    std::memset(static_cast<void *>(entries.get()), 0, element_count * sizeof(Entry));
+    for_each_node([&](const Node *node) {
+        const size_t hash = NodeHash(node);
+        Entry &entry = entries[next[MixHash(hash) & (bucket_count - 1)]++];
+        entry.hash = hash;
+        std::memcpy(static_cast<void *>(&entry.key), &node->key, sizeof(Key));
+        std::memcpy(static_cast<void *>(&entry.value), &node->value, sizeof(Value));
+    });
+
+    HashTableSnapshotHeader header{};
+    header.magic = HashTableSnapshotHeader::kMagic;
+    header.version = HashTableSnapshotHeader::kVersion;
+    header.entry_size = sizeof(Entry);
+    header.key_size = sizeof(Key);
+    header.value_size = sizeof(Value);
+    header.element_count = element_count;
+    header.bucket_count = bucket_count;
+    if constexpr (HashTableIsReseedable<Hash>::value) {
+        header.hash_seed = hasher.Seed();
+    }
+    const size_t entries_offset = HashTableSnapshot<Key, Value, Hash, KeyEqual>::EntriesOffset(bucket_count);
+    const size_t padding = entries_offset - sizeof(header) - offsets.size() * sizeof(uint64_t);
+    const char zeros[alignof(Entry)] = {};
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(offsets.data()),
+               static_cast<std::streamsize>(offsets.size() * sizeof(uint64_t)));
+    file.write(zeros, static_cast<std::streamsize>(padding));
+    file.write(reinterpret_cast<const char *>(entries.get()),
+               static_cast<std::streamsize>(element_count * sizeof(Entry)));
+    if (!file) {
+        throw std::runtime_error("Cannot write snapshot file!\n");
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>
+HashTable<Key, Value, Hash, KeyEqual, StoreHash>::LoadSnapshot(const std::string &path, const Hash &hash, const KeyEqual &equal) {
+    const HashTableSnapshot<Key, Value, Hash, KeyEqual> snapshot(path, hash, equal);
+    HashTable table(16, 0.75, hash, equal);
+    if constexpr (HashTableIsReseedable<Hash>::value) {
+        // The stored hashes are only valid under the seed they were computed with.
+        table.hasher.Reseed(snapshot.HashSeed());
+    }
+    table.Reserve(snapshot.Size());
+    // The entries carry their hashes, so the nodes are linked in without hashing or comparing. Equal keys are adjacent
+    // in the snapshot and land in the same bucket one after another, so prepending keeps their runs contiguous.
+    for (const auto *entry = snapshot.Begin(); entry != snapshot.End(); ++entry) {
+        // KeyEqual only runs for neighbours with equal hashes, to find out whether the table was a multimap.
+        if (!table.multimap && entry != snapshot.Begin() && entry[-1].hash == entry->hash &&
+            table.key_equal(entry[-1].key, entry->key)) {
+            table.multimap = true;
+        }
+        Node *&bucket = table.buckets[IndexFor(entry->hash, table.table_size)];
+        bucket = table.pool.Create(bucket, entry->hash, entry->key, entry->value);
+        ++table.element_count;
+    }
+    return table;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual, bool StoreHash>
+void HashTable<Key, Value, Hash, KeyEqual, StoreHash>::Show() const {
+    for (size_t i = 0; i < table_size; ++i) {
+        Node *current = buckets[i];
         std::cout << "Bucket number: " << i << ": ";
         while (current != nullptr) {
             std::cout << "[" << current->key << ", " << current->value << "] -> ";
-            current = current->next.get();
+            current = current->next;
+        }
+        std::cout << "nullptr" << std::endl;
+    }
+    for (size_t i = rehash_index; i < old_buckets.size(); ++i) {
+        Node *current = old_buckets[i];
+        std::cout << "Old bucket number: " << i << ": ";
+        while (current != nullptr) {
+            std::cout << "[" << current->key << ", " << current->value << "] -> ";
+            current = current->next;
         }
         std::cout << "nullptr" << std::endl;
     }
@@ -0,0 +1,288 @@
+#ifndef HASHTABLESNAPSHOT_H
+#define HASHTABLESNAPSHOT_H
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "HashMix.h"
+#include "SeededHash.h"
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HASHTABLESNAPSHOT_MMAP 1
+#else
+#define HASHTABLESNAPSHOT_MMAP 0
+#endif
+
+/*
+ * Binary snapshot format of a hash table with trivially copyable keys and values, in the byte order of the machine
+ * that wrote it:
+ *  - HashTableSnapshotHeader.
+ *  - bucket_count + 1 offsets (uint64_t): the entries of bucket i are entries[offsets[i]] .. entries[offsets[i + 1]).
+ *  - Padding up to the alignment of the entries, then element_count HashTableSnapshotEntry records grouped by bucket.
+ * The bucket of an entry is MixHash(hash) & (bucket_count - 1), and bucket_count is a power of two.
+ */
+struct HashTableSnapshotHeader {
+    static constexpr uint64_t kMagic = 0x31504E5348544441; // "ADTHSNP1"
+    static constexpr uint32_t kVersion = 1;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t entry_size;
+    uint32_t key_size;
+    uint32_t value_size;
+    uint64_t element_count;
+    uint64_t bucket_count;
+    uint64_t hash_seed;
+};
+
+template<typename Key, typename Value>
+struct HashTableSnapshotEntry {
+    uint64_t hash;
+    Key key;
+    Value value;
+};
+
+/*
+ * Read-only view of a whole file: memory-mapped where the platform has mmap, read into memory otherwise.
+ */
+class MappedFile {
+    const unsigned char *data = nullptr;
+    size_t size = 0;
+    std::unique_ptr<std::max_align_t[]> buffer;
+
+public:
+    explicit MappedFile(const std::string &path);
+
+    MappedFile(const MappedFile &other) = delete;
+
+    MappedFile &operator=(const MappedFile &other) = delete;
+
+    ~MappedFile();
+
+    [[nodiscard]] const unsigned char *Data() const {
+        return data;
+    }
+
+    [[nodiscard]] size_t Size() const {
+        return size;
+    }
+};
+
+inline MappedFile::MappedFile(const std::string &path) {
+#if HASHTABLESNAPSHOT_MMAP
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("Cannot open snapshot file!\n");
+    }
+    struct stat info{};
+    if (fstat(descriptor, &info) != 0) {
+        close(descriptor);
+        throw std::runtime_error("Cannot open snapshot file!\n");
+    }
+    size = static_cast<size_t>(info.st_size);
+    if (size != 0) {
+        void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED) {
+            close(descriptor);
+            throw std::runtime_error("Cannot map snapshot file!\n");
+        }
+        data = static_cast<const unsigned char *>(mapping);
+    }
+    close(descriptor);
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Cannot open snapshot file!\n");
+    }
+    size = static_cast<size_t>(file.tellg());
+    buffer.reset(new std::max_align_t[size / sizeof(std::max_align_t) + 1]);
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(buffer.get()), static_cast<std::streamsize>(size));
+    data = reinterpret_cast<const unsigned char *>(buffer.get());
+#endif
+}
+
+inline MappedFile::~MappedFile() {
+#if HASHTABLESNAPSHOT_MMAP
+    if (data != nullptr) {
+        munmap(const_cast<unsigned char *>(data), size);
+    }
+#endif
+}
+
+/**
+ * Read-only hash table served directly from a snapshot file written by HashTable::SaveSnapshot.
+ *
+ * Constructors:
+ *  - HashTableSnapshot(const std::string &path, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual()): Maps
+ *    the file and checks its header. Throws std::runtime_error if the file can not be read, is not a snapshot of
+ *    this key and value type, or was written with a different hash function.
+ *  - The view is neither copyable nor movable; it owns the mapping.
+ *
+ * Public Methods:
+ *  - const Value *Find(const Key &key) const: Returns a pointer into the mapping, or nullptr if the key is not found.
+ *  - const Value &Get(const Key &key) const: Same as Find, but throws an exception if the key is not found.
+ *  - bool ContainsKey(const Key &key) const: Returns true if the snapshot contains the key.
+ *  - [[nodiscard]] size_t Size() const / size_t BucketCount() const: Number of entries and buckets.
+ *  - [[nodiscard]] uint64_t HashSeed() const: Seed of the hash function of the table that wrote the snapshot. A
+ *    reseedable hash (see SeededHash.h) is re-seeded with it, so the stored hashes stay valid.
+ *  - const Entry *Begin() const / const Entry *End() const: The entries, grouped by bucket.
+ *
+ * Time Complexity:
+ *  - Constructor: O(bucket_count) to validate the bucket offsets; the entry pages are only read on first access.
+ *    O(file size) without mmap.
+ *  - Find, Get, ContainsKey: O(1) on average.
+ *
+ * Features:
+ * - Nothing is parsed or allocated per entry, so opening even a very large snapshot is immediate.
+ * - Every entry keeps its full hash, which lets HashTable::LoadSnapshot build its chains without hashing the keys.
+ */
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key> >
+class HashTableSnapshot {
+public:
+    using Entry = HashTableSnapshotEntry<Key, Value>;
+
+private:
+    static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+                  "Snapshots hold trivially copyable keys and values only");
+
+    MappedFile file;
+    const HashTableSnapshotHeader *header = nullptr;
+    const uint64_t *offsets = nullptr;
+    const Entry *entries = nullptr;
+    Hash hasher;
+    KeyEqual key_equal;
+
+public:
+    explicit HashTableSnapshot(const std::string &path, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual());
+
+    HashTableSnapshot(const HashTableSnapshot &other) = delete;
+
+    HashTableSnapshot &operator=(const HashTableSnapshot &other) = delete;
+
+    // Offset of the first entry in a snapshot of bucket_count buckets.
+    static size_t EntriesOffset(size_t bucket_count);
+
+    const Value *Find(const Key &key) const;
+
+    const Value &Get(const Key &key) const;
+
+    bool ContainsKey(const Key &key) const;
+
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t BucketCount() const;
+
+    [[nodiscard]] uint64_t HashSeed() const;
+
+    const Entry *Begin() const;
+
+    const Entry *End() const;
+};
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTableSnapshot<Key, Value, Hash, KeyEqual>::EntriesOffset(const size_t bucket_count) {
+    const size_t offset = sizeof(HashTableSnapshotHeader) + (bucket_count + 1) * sizeof(uint64_t);
+    return (offset + alignof(Entry) - 1) / alignof(Entry) * alignof(Entry);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+HashTableSnapshot<Key, Value, Hash, KeyEqual>::HashTableSnapshot(const std::string &path, const Hash &hash,
+                                                                 const KeyEqual &equal)
+    : file(path), hasher(hash), key_equal(equal) {
+    if (file.Size() < sizeof(HashTableSnapshotHeader)) {
+        throw std::runtime_error("Invalid snapshot file!\n");
+    }
+    header = reinterpret_cast<const HashTableSnapshotHeader *>(file.Data());
+    if constexpr (HashTableIsReseedable<Hash>::value) {
+        hasher.Reseed(header->hash_seed);
+    }
+    const uint64_t bucket_count = header->bucket_count;
+    const uint64_t element_count = header->element_count;
+    // The counts come from the file, so every size is bounded by the file size before it is multiplied.
+    if (header->magic != HashTableSnapshotHeader::kMagic || header->version != HashTableSnapshotHeader::kVersion ||
+        header->entry_size != sizeof(Entry) || header->key_size != sizeof(Key) ||
+        header->value_size != sizeof(Value) || bucket_count == 0 || (bucket_count & (bucket_count - 1)) != 0 ||
+        bucket_count > file.Size() / sizeof(uint64_t) || EntriesOffset(bucket_count) > file.Size() ||
+        element_count > (file.Size() - EntriesOffset(bucket_count)) / sizeof(Entry) ||
+        file.Size() != EntriesOffset(bucket_count) + element_count * sizeof(Entry)) {
+        throw std::runtime_error("Invalid snapshot file!\n");
+    }
+    offsets = reinterpret_cast<const uint64_t *>(file.Data() + sizeof(HashTableSnapshotHeader));
+    entries = reinterpret_cast<const Entry *>(file.Data() + EntriesOffset(bucket_count));
+    if (offsets[0] != 0 || offsets[bucket_count] != element_count) {
+        throw std::runtime_error("Invalid snapshot file!\n");
+    }
+    for (uint64_t i = 0; i < bucket_count; ++i) {
+        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > element_count) {
+            throw std::runtime_error("Invalid snapshot file!\n");
+        }
+    }
+    // The chains are only valid for the hash function that wrote them.
+    if (element_count != 0 && entries[0].hash != hasher(entries[0].key)) {
+        throw std::runtime_error("Snapshot was written with a different hash function!\n");
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const Value *HashTableSnapshot<Key, Value, Hash, KeyEqual>::Find(const Key &key) const {
+    const uint64_t hash = hasher(key);
+    const size_t bucket = MixHash(hash) & (header->bucket_count - 1);
+    for (uint64_t i = offsets[bucket]; i < offsets[bucket + 1]; ++i) {
+        if (entries[i].hash == hash && key_equal(entries[i].key, key)) {
+            return &entries[i].value;
+        }
+    }
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const Value &HashTableSnapshot<Key, Value, Hash, KeyEqual>::Get(const Key &key) const {
+    const Value *value = Find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool HashTableSnapshot<Key, Value, Hash, KeyEqual>::ContainsKey(const Key &key) const {
+    return Find(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTableSnapshot<Key, Value, Hash, KeyEqual>::Size() const {
+    return header->element_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTableSnapshot<Key, Value, Hash, KeyEqual>::BucketCount() const {
+    return header->bucket_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+uint64_t HashTableSnapshot<Key, Value, Hash, KeyEqual>::HashSeed() const {
+    return header->hash_seed;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const typename HashTableSnapshot<Key, Value, Hash, KeyEqual>::Entry *
+HashTableSnapshot<Key, Value, Hash, KeyEqual>::Begin() const {
+    return entries;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const typename HashTableSnapshot<Key, Value, Hash, KeyEqual>::Entry *
+HashTableSnapshot<Key, Value, Hash, KeyEqual>::End() const {
+    return entries + header->element_count;
+}
+
+
+#endif //HASHTABLESNAPSHOT_H
@@ -0,0 +1,95 @@
+#ifndef HASHTABLESTATS_H
+#define HASHTABLESTATS_H
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+/*
+ * Per-operation counters of a hash table. They are only updated when HASHTABLE_ENABLE_COUNTERS is defined before
+ * the table header is included; otherwise HASHTABLE_COUNT drops the statements. The counter field of the table and
+ * the fields below exist either way, so the macro changes no class layout.
+ */
+#ifdef HASHTABLE_ENABLE_COUNTERS
+#define HASHTABLE_COUNT(statement) statement
+#else
+#define HASHTABLE_COUNT(statement)
+#endif
+
+struct HashTableCounters {
+    size_t comparisons = 0;
+    size_t successful_lookups = 0;
+    size_t successful_comparisons = 0;
+    size_t unsuccessful_lookups = 0;
+    size_t unsuccessful_comparisons = 0;
+    size_t inserts = 0;
+    size_t removes = 0;
+};
+
+/**
+ * Snapshot of the shape of a hash table, returned by HashTable::Stats().
+ *
+ * Fields:
+ *  - chain_length_histogram: Element i is the number of buckets whose chain holds i nodes.
+ *  - max_chain_length: Length of the longest chain.
+ *  - bucket_count, element_count: Number of buckets (both arrays during an incremental resize) and of pairs.
+ *  - empty_bucket_ratio: Share of buckets with an empty chain.
+ *  - resize_count: Number of rehashes since the table was created.
+ *  - reseed_count: Number of times a too long chain made the table re-seed its hash.
+ *  - bytes_used: Memory held by the table: the object itself, the bucket arrays and the node slabs.
+ *  - expected_successful_comparisons: Average number of nodes visited by a lookup of a present key, computed from
+ *    the chain lengths, assuming every key is looked up equally often.
+ *  - expected_unsuccessful_comparisons: Average number of nodes visited by a lookup of a missing key, i.e. the
+ *    average chain length over all buckets.
+ *  - counters_enabled, counters: The measured per-operation counters, if HASHTABLE_ENABLE_COUNTERS is defined.
+ *
+ * Public Methods:
+ *  - double MeasuredSuccessfulComparisons() const / double MeasuredUnsuccessfulComparisons() const: Average number
+ *    of nodes visited by the lookups counted so far, 0 without counters.
+ *  - void Show() const: Prints the statistics.
+ */
+struct HashTableStats {
+    std::vector<size_t> chain_length_histogram;
+    size_t max_chain_length = 0;
+    size_t bucket_count = 0;
+    size_t element_count = 0;
+    double empty_bucket_ratio = 0.0;
+    size_t resize_count = 0;
+    size_t reseed_count = 0;
+    size_t bytes_used = 0;
+    double expected_successful_comparisons = 0.0;
+    double expected_unsuccessful_comparisons = 0.0;
+    bool counters_enabled = false;
+    HashTableCounters counters;
+
+    [[nodiscard]] double MeasuredSuccessfulComparisons() const {
+        return counters.successful_lookups == 0
+                   ? 0.0
+                   : static_cast<double>(counters.successful_comparisons) / counters.successful_lookups;
+    }
+
+    [[nodiscard]] double MeasuredUnsuccessfulComparisons() const {
+        return counters.unsuccessful_lookups == 0
+                   ? 0.0
+                   : static_cast<double>(counters.unsuccessful_comparisons) / counters.unsuccessful_lookups;
+    }
+
+    void Show() const {
+        std::cout << "Elements: " << element_count << ", buckets: " << bucket_count << ", empty buckets: "
+                << empty_bucket_ratio * 100 << "%, resizes: " << resize_count << ", reseeds: " << reseed_count
+                << ", bytes: " << bytes_used << std::endl;
+        std::cout << "Max chain: " << max_chain_length << ", expected comparisons: hit "
+                << expected_successful_comparisons << ", miss " << expected_unsuccessful_comparisons << std::endl;
+        for (size_t length = 0; length < chain_length_histogram.size(); ++length) {
+            std::cout << "Chains of length " << length << ": " << chain_length_histogram[length] << std::endl;
+        }
+        if (counters_enabled) {
+            std::cout << "Measured comparisons: hit " << MeasuredSuccessfulComparisons() << " over "
+                    << counters.successful_lookups << " lookups, miss " << MeasuredUnsuccessfulComparisons()
+                    << " over " << counters.unsuccessful_lookups << " lookups" << std::endl;
+            std::cout << "Inserts: " << counters.inserts << ", removes: " << counters.removes << std::endl;
+        }
+    }
+};
+
+
+#endif //HASHTABLESTATS_H
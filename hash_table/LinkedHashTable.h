@@ -0,0 +1,685 @@
+#ifndef LINKEDHASHTABLE_H
+#define LINKEDHASHTABLE_H
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "HashMix.h"
+#include "SeededHash.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" that remembers the insertion order.
+ *
+ * The LinkedHashTable class provides the same surface as HashTable, but keeps the key-value pairs in a dense array in
+ * the order they were inserted. The hash index is a separate open-addressing array that only holds the positions of
+ * the pairs in that array (the layout of the "compact dict" of CPython).
+ *
+ * Constructors:
+ *  - LinkedHashTable(size_t capacity = 8, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual()): Initializes
+ *    an empty table with room for at least capacity pairs.
+ *  - LinkedHashTable(const LinkedHashTable &other): Copy constructor, copies the pairs in their order.
+ *  - LinkedHashTable(LinkedHashTable &&other) noexcept: Move constructor, transfers ownership of the arrays.
+ *
+ * Destructor:
+ *  - ~LinkedHashTable(): Destroys all stored pairs and releases the arrays.
+ *
+ * Overloaded Operators:
+ *  - LinkedHashTable& operator=(const LinkedHashTable &other): Copy assignment operator.
+ *  - LinkedHashTable& operator=(LinkedHashTable &&other) noexcept: Move assignment operator.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value) / void Insert(Key &&key, Value &&value): Appends a key-value pair.
+ *    The value of an existing key is overwritten and the key keeps its place in the order.
+ *  - Value &Get(const Key &key): Retrieves the value associated with the key. Throws an exception if the key is not found.
+ *  - Value *Find(const Key &key): Returns a pointer to the value associated with the key, or nullptr.
+ *  - void Remove(const Key &key): Removes the key. Throws an exception if the key is not found.
+ *  - void Clear(): Removes all key-value pairs, keeping the allocated arrays.
+ *  - bool ContainsKey(const Key &key): Returns true if the table contains the key, false otherwise.
+ *  - [[nodiscard]] bool IsEmpty() const: Returns true if the table is empty.
+ *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs in the table.
+ *  - [[nodiscard]] size_t Capacity() const: Number of pairs the table holds before it has to grow.
+ *  - [[nodiscard]] size_t BytesUsed() const: Memory held by the table, the pair array and the index.
+ *  - void Reserve(size_t count): Grows the table at once to hold count pairs.
+ *  - void ShrinkToFit(): Drops the holes left by Remove and shrinks both arrays to the current number of pairs.
+ *  - Iterator Begin() / Iterator End(), begin() / end(): Traversal in insertion order, for range-based for loops:
+ *    for (auto [key, value] : table).
+ *  - void Show() const: Prints the pairs in insertion order.
+ *
+ * Private Methods:
+ *  - size_t HashOf(const Key &key) const: Hash of the key; never equal to kRemoved, which marks a hole.
+ *  - size_t ReadIndex(size_t slot) const / void WriteIndex(size_t slot, size_t value): Access to the index, whose
+ *    slots are 1, 2, 4 or 8 bytes wide - the narrowest width that can address every pair of the array.
+ *  - size_t FindSlot(const Key &key, size_t hash) const: Index slot that points to the key, or kNone.
+ *  - size_t FreeSlot(size_t hash) const: First empty or removed index slot on the probe sequence of the hash.
+ *  - void Rebuild(size_t new_index_size): Moves the pairs, without the holes, into new arrays and indexes them again.
+ *
+ * Time Complexity:
+ *  - Insert, Get, Find, Remove, ContainsKey: O(1) on average.
+ *  - Begin, operator++: O(1) amortized over a full traversal of O(n + number of holes).
+ *  - Clear, Reserve, ShrinkToFit: O(n + capacity).
+ *
+ * Features:
+ * - Iteration walks one contiguous array in insertion order, so it is deterministic and reads memory sequentially.
+ *   It does not depend on the hash function or on its seed.
+ * - A pair costs its key and value, its cached hash and one index slot of 1 to 8 bytes per 2/3 pair, instead of a
+ *   node with a next pointer plus a bucket pointer.
+ * - Remove destroys the pair at once and leaves a hole in the array; the holes are dropped when the array is full
+ *   and is rebuilt, so the order of the remaining pairs never changes.
+ * - Insert may rebuild the arrays and invalidates iterators and pointers to values. Remove invalidates nothing but
+ *   the removed pair.
+ */
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key> >
+class LinkedHashTable {
+    struct Pair {
+        Key key;
+        Value value;
+
+        template<typename K, typename V>
+        Pair(K &&key, V &&value) : key(std::forward<K>(key)), value(std::forward<V>(value)) {
+        }
+    };
+
+    struct Item {
+        // Cached hash of the key, kRemoved for a hole.
+        size_t hash;
+        alignas(Pair) unsigned char storage[sizeof(Pair)];
+
+        Pair &Get() {
+            return *std::launder(reinterpret_cast<Pair *>(storage));
+        }
+
+        const Pair &Get() const {
+            return *std::launder(reinterpret_cast<const Pair *>(storage));
+        }
+    };
+
+    static constexpr size_t kRemoved = static_cast<size_t>(-1);
+    static constexpr size_t kNone = static_cast<size_t>(-1);
+    // Index slot values: 0 is an empty slot, 1 a removed one, and n + kFirstItem points to items[n].
+    static constexpr size_t kEmptySlot = 0;
+    static constexpr size_t kRemovedSlot = 1;
+    static constexpr size_t kFirstItem = 2;
+    static constexpr size_t kMinIndexSize = 8;
+
+    Item *items;
+    // Items in use, holes included.
+    size_t item_count;
+    size_t element_count;
+    size_t index_size;
+    size_t index_width;
+    std::vector<unsigned char> index;
+    Hash hasher;
+    KeyEqual key_equal;
+
+    static size_t UsableFor(size_t index_size);
+
+    static size_t IndexSizeFor(size_t count);
+
+    static size_t WidthFor(size_t index_size);
+
+    [[nodiscard]] size_t HashOf(const Key &key) const;
+
+    [[nodiscard]] size_t ReadIndex(size_t slot) const;
+
+    void WriteIndex(size_t slot, size_t value);
+
+    [[nodiscard]] size_t FindSlot(const Key &key, size_t hash) const;
+
+    [[nodiscard]] size_t FreeSlot(size_t hash) const;
+
+    void AllocateIndex(size_t new_index_size);
+
+    void DestroyItems();
+
+    void Rebuild(size_t new_index_size);
+
+    void CopyFrom(const LinkedHashTable &other);
+
+    template<typename K, typename V>
+    void InsertImpl(K &&key, V &&value);
+
+    /*
+    * Iterator class:
+    * - Iterator: Forward traversal over the key-value pairs in insertion order, skipping the holes.
+    *   - bool operator!=(const Iterator &other) const: Checks if two iterators point to different pairs.
+    *   - Iterator &operator++(): Advances the iterator to the next key-value pair.
+    *   - Iterator operator++(int): Advances the iterator and returns a copy of the previous iterator.
+    *   - Entry operator*() const: Returns the key and a reference to the value of the current pair.
+    *   - EntryPointer operator->() const: Provides access to the key and the value as it->key and it->value.
+    *
+    */
+public:
+    struct Entry {
+        const Key &key;
+        Value &value;
+    };
+
+    class Iterator {
+        Item *item;
+        Item *item_end;
+
+        void SkipHoles();
+
+    public:
+        struct EntryPointer {
+            Entry entry;
+
+            const Entry *operator->() const {
+                return &entry;
+            }
+        };
+
+        Iterator(Item *item, Item *item_end);
+
+        bool operator!=(const Iterator &other) const;
+
+        bool operator==(const Iterator &other) const;
+
+        Iterator &operator++();
+
+        Iterator operator++(int);
+
+        Entry operator*() const;
+
+        EntryPointer operator->() const;
+    };
+
+    // --- Constructors ---
+    explicit LinkedHashTable(size_t capacity = 8, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual());
+
+    LinkedHashTable(const LinkedHashTable &other);
+
+    LinkedHashTable(LinkedHashTable &&other) noexcept;
+
+    // --- Overload operators ---
+    LinkedHashTable &operator=(const LinkedHashTable &other);
+
+    LinkedHashTable &operator=(LinkedHashTable &&other) noexcept;
+
+    // --- Destructors ---
+    ~LinkedHashTable();
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    void Insert(Key &&key, Value &&value);
+
+    // --- Get element ---
+    Value &Get(const Key &key);
+
+    Value *Find(const Key &key);
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key);
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t Capacity() const;
+
+    [[nodiscard]] size_t BytesUsed() const;
+
+    // --- Change size in hash table ---
+    void Reserve(size_t count);
+
+    void ShrinkToFit();
+
+    // --- Traversal in insertion order ---
+    Iterator Begin();
+
+    Iterator End();
+
+    Iterator begin();
+
+    Iterator end();
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::UsableFor(const size_t index_size) {
+    // At most 2/3 of the index slots are used, which keeps the linear probe sequences short.
+    return index_size * 2 / 3;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::IndexSizeFor(const size_t count) {
+    size_t result = kMinIndexSize;
+    while (UsableFor(result) < count) {
+        result *= 2;
+    }
+    return result;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::WidthFor(const size_t index_size) {
+    const size_t largest = UsableFor(index_size) - 1 + kFirstItem;
+    if (largest <= UINT8_MAX) {
+        return 1;
+    }
+    if (largest <= UINT16_MAX) {
+        return 2;
+    }
+    if (largest <= UINT32_MAX) {
+        return 4;
+    }
+    return 8;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::HashOf(const Key &key) const {
+    const size_t hash = hasher(key);
+    return hash == kRemoved ? hash - 1 : hash;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::ReadIndex(const size_t slot) const {
+    const unsigned char *address = index.data() + slot * index_width;
+    switch (index_width) {
+        case 1:
+            return *address;
+        case 2: {
+            uint16_t value;
+            std::memcpy(&value, address, sizeof(value));
+            return value;
+        }
+        case 4: {
+            uint32_t value;
+            std::memcpy(&value, address, sizeof(value));
+            return value;
+        }
+        default: {
+            uint64_t value;
+            std::memcpy(&value, address, sizeof(value));
+            return static_cast<size_t>(value);
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::WriteIndex(const size_t slot, const size_t value) {
+    unsigned char *address = index.data() + slot * index_width;
+    switch (index_width) {
+        case 1:
+            *address = static_cast<uint8_t>(value);
+            break;
+        case 2: {
+            const auto narrow = static_cast<uint16_t>(value);
+            std::memcpy(address, &narrow, sizeof(narrow));
+            break;
+        }
+        case 4: {
+            const auto narrow = static_cast<uint32_t>(value);
+            std::memcpy(address, &narrow, sizeof(narrow));
+            break;
+        }
+        default: {
+            const auto wide = static_cast<uint64_t>(value);
+            std::memcpy(address, &wide, sizeof(wide));
+            break;
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::FindSlot(const Key &key, const size_t hash) const {
+    const size_t mask = index_size - 1;
+    for (size_t slot = MixHash(hash) & mask;; slot = (slot + 1) & mask) {
+        const size_t value = ReadIndex(slot);
+        if (value == kEmptySlot) {
+            return kNone;
+        }
+        if (value != kRemovedSlot) {
+            const Item &item = items[value - kFirstItem];
+            if (item.hash == hash && key_equal(item.Get().key, key)) {
+                return slot;
+            }
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::FreeSlot(const size_t hash) const {
+    const size_t mask = index_size - 1;
+    size_t slot = MixHash(hash) & mask;
+    while (ReadIndex(slot) >= kFirstItem) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::AllocateIndex(const size_t new_index_size) {
+    index_size = new_index_size;
+    index_width = WidthFor(new_index_size);
+    index.assign(new_index_size * index_width, 0);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::DestroyItems() {
+    for (size_t i = 0; i < item_count; ++i) {
+        if (items[i].hash != kRemoved) {
+            items[i].Get().~Pair();
+        }
+    }
+    item_count = 0;
+    element_count = 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::Rebuild(const size_t new_index_size) {
+    Item *new_items = new Item[UsableFor(new_index_size)];
+    size_t count = 0;
+    for (size_t i = 0; i < item_count; ++i) {
+        if (items[i].hash != kRemoved) {
+            new_items[count].hash = items[i].hash;
+            new(new_items[count].storage) Pair(std::move(items[i].Get()));
+            items[i].Get().~Pair();
+            ++count;
+        }
+    }
+    delete[] items;
+    items = new_items;
+    item_count = count;
+    AllocateIndex(new_index_size);
+    for (size_t i = 0; i < item_count; ++i) {
+        WriteIndex(FreeSlot(items[i].hash), i + kFirstItem);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::CopyFrom(const LinkedHashTable &other) {
+    const size_t new_index_size = IndexSizeFor(other.element_count);
+    items = new Item[UsableFor(new_index_size)];
+    item_count = 0;
+    for (size_t i = 0; i < other.item_count; ++i) {
+        if (other.items[i].hash != kRemoved) {
+            new(items[item_count].storage) Pair(other.items[i].Get());
+            items[item_count].hash = other.items[i].hash;
+            ++item_count;
+        }
+    }
+    element_count = item_count;
+    hasher = other.hasher;
+    key_equal = other.key_equal;
+    AllocateIndex(new_index_size);
+    for (size_t i = 0; i < item_count; ++i) {
+        WriteIndex(FreeSlot(items[i].hash), i + kFirstItem);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K, typename V>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::InsertImpl(K &&key, V &&value) {
+    if (index_size == 0) {
+        // A moved-from table owns no arrays.
+        Rebuild(kMinIndexSize);
+    }
+    const size_t hash = HashOf(key);
+    if (const size_t slot = FindSlot(key, hash); slot != kNone) {
+        items[ReadIndex(slot) - kFirstItem].Get().value = std::forward<V>(value);
+        return;
+    }
+    if (item_count == UsableFor(index_size)) {
+        // The array is full: drop the holes, and grow unless that frees at least half of it.
+        Rebuild(IndexSizeFor(element_count * 2));
+    }
+    Item &item = items[item_count];
+    new(item.storage) Pair(std::forward<K>(key), std::forward<V>(value));
+    item.hash = hash;
+    WriteIndex(FreeSlot(hash), item_count + kFirstItem);
+    ++item_count;
+    ++element_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LinkedHashTable<Key, Value, Hash, KeyEqual>::LinkedHashTable(const size_t capacity, const Hash &hash,
+                                                             const KeyEqual &equal)
+    : items(nullptr), item_count(0), element_count(0), index_size(0), index_width(0), hasher(hash),
+      key_equal(equal) {
+    const size_t new_index_size = IndexSizeFor(capacity);
+    items = new Item[UsableFor(new_index_size)];
+    AllocateIndex(new_index_size);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LinkedHashTable<Key, Value, Hash, KeyEqual>::LinkedHashTable(const LinkedHashTable &other)
+    : items(nullptr), item_count(0), element_count(0), index_size(0), index_width(0), hasher(other.hasher),
+      key_equal(other.key_equal) {
+    CopyFrom(other);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LinkedHashTable<Key, Value, Hash, KeyEqual>::LinkedHashTable(LinkedHashTable &&other) noexcept
+    : items(other.items), item_count(other.item_count), element_count(other.element_count),
+      index_size(other.index_size), index_width(other.index_width), index(std::move(other.index)),
+      hasher(std::move(other.hasher)), key_equal(std::move(other.key_equal)) {
+    other.items = nullptr;
+    other.item_count = 0;
+    other.element_count = 0;
+    other.index_size = 0;
+    other.index_width = 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LinkedHashTable<Key, Value, Hash, KeyEqual> &
+LinkedHashTable<Key, Value, Hash, KeyEqual>::operator=(const LinkedHashTable &other) {
+    if (this != &other) {
+        DestroyItems();
+        delete[] items;
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LinkedHashTable<Key, Value, Hash, KeyEqual> &
+LinkedHashTable<Key, Value, Hash, KeyEqual>::operator=(LinkedHashTable &&other) noexcept {
+    if (this != &other) {
+        DestroyItems();
+        delete[] items;
+        items = other.items;
+        item_count = other.item_count;
+        element_count = other.element_count;
+        index_size = other.index_size;
+        index_width = other.index_width;
+        index = std::move(other.index);
+        hasher = std::move(other.hasher);
+        key_equal = std::move(other.key_equal);
+
+        other.items = nullptr;
+        other.item_count = 0;
+        other.element_count = 0;
+        other.index_size = 0;
+        other.index_width = 0;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LinkedHashTable<Key, Value, Hash, KeyEqual>::~LinkedHashTable() {
+    DestroyItems();
+    delete[] items;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::Insert(const Key &key, const Value &value) {
+    InsertImpl(key, value);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::Insert(Key &&key, Value &&value) {
+    InsertImpl(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+Value &LinkedHashTable<Key, Value, Hash, KeyEqual>::Get(const Key &key) {
+    Value *value = Find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+Value *LinkedHashTable<Key, Value, Hash, KeyEqual>::Find(const Key &key) {
+    if (index_size == 0) {
+        return nullptr;
+    }
+    const size_t slot = FindSlot(key, HashOf(key));
+    return slot == kNone ? nullptr : &items[ReadIndex(slot) - kFirstItem].Get().value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::Remove(const Key &key) {
+    const size_t slot = index_size == 0 ? kNone : FindSlot(key, HashOf(key));
+    if (slot == kNone) {
+        throw std::out_of_range("No such key exists!\n");
+    }
+    Item &item = items[ReadIndex(slot) - kFirstItem];
+    item.Get().~Pair();
+    item.hash = kRemoved;
+    // The index slot stays taken, so the probe sequences that pass through it are not cut.
+    WriteIndex(slot, kRemovedSlot);
+    --element_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::Clear() {
+    DestroyItems();
+    std::fill(index.begin(), index.end(), 0);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LinkedHashTable<Key, Value, Hash, KeyEqual>::ContainsKey(const Key &key) {
+    return Find(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LinkedHashTable<Key, Value, Hash, KeyEqual>::IsEmpty() const {
+    return element_count == 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::Size() const {
+    return element_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::Capacity() const {
+    return index_size == 0 ? 0 : UsableFor(index_size);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LinkedHashTable<Key, Value, Hash, KeyEqual>::BytesUsed() const {
+    return sizeof(*this) + Capacity() * sizeof(Item) + index.capacity();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::Reserve(const size_t count) {
+    if (count > Capacity()) {
+        Rebuild(IndexSizeFor(count));
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::ShrinkToFit() {
+    Rebuild(IndexSizeFor(element_count));
+    index.shrink_to_fit();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::SkipHoles() {
+    while (item != item_end && item->hash == kRemoved) {
+        ++item;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::Iterator(Item *item, Item *item_end)
+    : item(item), item_end(item_end) {
+    SkipHoles();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator!=(const Iterator &other) const {
+    return item != other.item;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator==(const Iterator &other) const {
+    return item == other.item;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator &
+LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator++() {
+    ++item;
+    SkipHoles();
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator
+LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator++(int) {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LinkedHashTable<Key, Value, Hash, KeyEqual>::Entry
+LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator*() const {
+    return {item->Get().key, item->Get().value};
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::EntryPointer
+LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator->() const {
+    return {{item->Get().key, item->Get().value}};
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator LinkedHashTable<Key, Value, Hash, KeyEqual>::Begin() {
+    return Iterator(items, items + item_count);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator LinkedHashTable<Key, Value, Hash, KeyEqual>::End() {
+    return Iterator(items + item_count, items + item_count);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator LinkedHashTable<Key, Value, Hash, KeyEqual>::begin() {
+    return Begin();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LinkedHashTable<Key, Value, Hash, KeyEqual>::Iterator LinkedHashTable<Key, Value, Hash, KeyEqual>::end() {
+    return End();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LinkedHashTable<Key, Value, Hash, KeyEqual>::Show() const {
+    for (size_t i = 0; i < item_count; ++i) {
+        if (items[i].hash != kRemoved) {
+            std::cout << "[" << items[i].Get().key << ", " << items[i].Get().value << "] -> ";
+        }
+    }
+    std::cout << "nullptr" << std::endl;
+}
+
+
+#endif //LINKEDHASHTABLE_H
@@ -0,0 +1,374 @@
+#ifndef LOCKFREEREADHASHTABLE_H
+#define LOCKFREEREADHASHTABLE_H
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include "EpochReclamation.h"
+#include "SeededHash.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" with lock-free readers.
+ *
+ * The LockFreeReadHashTable class uses the same chaining layout as ConcurrentHashTable, but readers never lock:
+ * every chain link and the bucket array itself are published with release stores, and readers walk them inside an
+ * EpochGuard. Writers serialize on striped mutexes and hand the nodes they unlink to the EpochDomain, which deletes
+ * them once no reader can reach them any more.
+ *
+ * Constructors:
+ *  - LockFreeReadHashTable(size_t table_size = 64, float load_factor = 0.75, size_t stripe_count = 64): Initializes
+ *    a table. The number of buckets is rounded up to a multiple of the number of stripes.
+ *  - The table is neither copyable nor movable, because the locks are not.
+ *
+ * Destructor:
+ *  - ~LockFreeReadHashTable(): Deletes the bucket array and its nodes. Must not race with any other operation.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value): Inserts a key-value pair, overwriting the value of an existing key.
+ *  - Value Get(const Key &key) const: Returns a copy of the value of the key. Throws an exception if the key is not found.
+ *  - bool TryGet(const Key &key, Value &value) const: Copies the value of the key into value, returns false if not found.
+ *  - void Remove(const Key &key): Removes the key. Throws an exception if the key is not found.
+ *  - void Clear(): Removes all key-value pairs.
+ *  - bool ContainsKey(const Key &key) const: Returns true if the table contains the key.
+ *  - [[nodiscard]] bool IsEmpty() const: Returns true if the table is empty.
+ *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs.
+ *  - [[nodiscard]] size_t BucketCount() const: Returns the number of buckets.
+ *  - void Resize(): Doubles the number of buckets.
+ *  - void Show() const: Prints the table. Must not race with writers.
+ *
+ * Private Methods:
+ *  - const Node *FindNode(const Key &key, size_t hash) const: Lock-free lookup; the caller holds an EpochGuard.
+ *  - void LockAll() / void UnlockAll(): Lock and unlock every stripe in a fixed order.
+ *  - void Rehash(size_t new_size): Publishes a new bucket array holding copies of all nodes and retires the old one.
+ *  - void Grow(): Doubles the table if it is still over the load factor once every stripe is locked.
+ *
+ * Time Complexity:
+ *  - Get, TryGet, ContainsKey: O(1) on average, with no lock and no read-modify-write on shared memory.
+ *  - Insert, Remove: O(1) on average, under the lock of one stripe.
+ *  - Clear, Resize: O(n), and they block every writer but no reader.
+ *  - IsEmpty, Size: O(1).
+ *
+ * Features:
+ * - A published node is never modified except for its next link: overwriting a value links in a new node in place
+ *   of the old one, so a reader always sees a consistent key-value pair.
+ * - Remove unlinks a node but leaves its own next link intact, so a reader that stands on it still finds the rest
+ *   of the chain.
+ * - A resize builds a complete new array of copied nodes and swaps it in with one release store. Readers that
+ *   still walk the old array see the table as it was before the resize, and the old array is retired as a whole.
+ * - The stripe of a key is hash % stripe_count and the number of buckets is a multiple of it, as in
+ *   ConcurrentHashTable, so bucket i is always guarded by stripe i % stripe_count.
+ * - Hash defaults to SeededHash (see SeededHash.h). A keyed hash matters here in particular: a chain made long on
+ *   purpose is walked by every lock-free reader of its bucket.
+ */
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key> >
+class LockFreeReadHashTable {
+    struct Node {
+        Key key;
+        Value value;
+        size_t hash;
+        std::atomic<Node *> next;
+
+        Node(const Key &key, const Value &value, size_t hash, Node *next)
+            : key(key), value(value), hash(hash), next(next) {
+        }
+    };
+
+    struct BucketArray {
+        size_t size;
+        std::unique_ptr<std::atomic<Node *>[]> heads;
+
+        explicit BucketArray(size_t size): size(size), heads(new std::atomic<Node *>[size]) {
+            for (size_t i = 0; i < size; ++i) {
+                heads[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        // The array owns its chains: nodes are never shared between two arrays.
+        ~BucketArray() {
+            for (size_t i = 0; i < size; ++i) {
+                Node *current = heads[i].load(std::memory_order_relaxed);
+                while (current != nullptr) {
+                    Node *next = current->next.load(std::memory_order_relaxed);
+                    delete current;
+                    current = next;
+                }
+            }
+        }
+    };
+
+    struct alignas(64) Stripe {
+        std::mutex mutex;
+    };
+
+    std::atomic<BucketArray *> buckets;
+    std::unique_ptr<Stripe[]> stripes;
+    size_t stripe_count;
+    std::atomic<size_t> element_count{0};
+    float load_refactor;
+    Hash hasher;
+    KeyEqual key_equal;
+
+    const Node *FindNode(const Key &key, size_t hash) const;
+
+    void LockAll();
+
+    void UnlockAll();
+
+    // Keeps every writer out until the end of its scope, readers are never blocked by it.
+    class AllStripesLock {
+        LockFreeReadHashTable &table;
+
+    public:
+        explicit AllStripesLock(LockFreeReadHashTable &table): table(table) {
+            table.LockAll();
+        }
+
+        AllStripesLock(const AllStripesLock &other) = delete;
+
+        AllStripesLock &operator=(const AllStripesLock &other) = delete;
+
+        ~AllStripesLock() {
+            table.UnlockAll();
+        }
+    };
+
+    void Rehash(size_t new_size);
+
+    void Grow();
+
+public:
+    // --- Constructors ---
+    explicit LockFreeReadHashTable(size_t table_size = 64, float load_factor = 0.75, size_t stripe_count = 64);
+
+    LockFreeReadHashTable(const LockFreeReadHashTable &other) = delete;
+
+    LockFreeReadHashTable(LockFreeReadHashTable &&other) = delete;
+
+    // --- Overload operators ---
+    LockFreeReadHashTable &operator=(const LockFreeReadHashTable &other) = delete;
+
+    LockFreeReadHashTable &operator=(LockFreeReadHashTable &&other) = delete;
+
+    // --- Destructors ---
+    ~LockFreeReadHashTable();
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    // --- Get element ---
+    Value Get(const Key &key) const;
+
+    bool TryGet(const Key &key, Value &value) const;
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key) const;
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t BucketCount() const;
+
+    // --- Change size in hash table ---
+    void Resize();
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const typename LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Node *
+LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::FindNode(const Key &key, const size_t hash) const {
+    const BucketArray *array = buckets.load(std::memory_order_acquire);
+    const Node *current = array->heads[hash % array->size].load(std::memory_order_acquire);
+    while (current != nullptr) {
+        if (current->hash == hash && key_equal(current->key, key)) {
+            return current;
+        }
+        current = current->next.load(std::memory_order_acquire);
+    }
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::LockAll() {
+    for (size_t i = 0; i < stripe_count; ++i) {
+        stripes[i].mutex.lock();
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::UnlockAll() {
+    for (size_t i = stripe_count; i > 0; --i) {
+        stripes[i - 1].mutex.unlock();
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Rehash(const size_t new_size) {
+    BucketArray *old_array = buckets.load(std::memory_order_relaxed);
+    auto new_array = std::make_unique<BucketArray>(new_size);
+    for (size_t i = 0; i < old_array->size; ++i) {
+        for (Node *current = old_array->heads[i].load(std::memory_order_relaxed); current != nullptr;
+             current = current->next.load(std::memory_order_relaxed)) {
+            std::atomic<Node *> &head = new_array->heads[current->hash % new_size];
+            head.store(new Node(current->key, current->value, current->hash, head.load(std::memory_order_relaxed)),
+                       std::memory_order_relaxed);
+        }
+    }
+    buckets.store(new_array.release(), std::memory_order_release);
+    EpochDomain::Instance().Retire(old_array);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Grow() {
+    AllStripesLock lock(*this);
+    // Inserts that crossed the load factor together queue up on the stripe locks; the later ones find the array
+    // that the first one published and leave it alone.
+    const size_t size = buckets.load(std::memory_order_relaxed)->size;
+    if (element_count.load(std::memory_order_relaxed) >= size * load_refactor) {
+        Rehash(size * 2);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::LockFreeReadHashTable(const size_t table_size,
+                                                                         const float load_factor,
+                                                                         const size_t stripe_count)
+    : stripes(new Stripe[stripe_count == 0 ? 1 : stripe_count]), stripe_count(stripe_count == 0 ? 1 : stripe_count),
+      load_refactor(load_factor) {
+    size_t size = (table_size + this->stripe_count - 1) / this->stripe_count * this->stripe_count;
+    size = size == 0 ? this->stripe_count : size;
+    buckets.store(new BucketArray(size), std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::~LockFreeReadHashTable() {
+    delete buckets.load(std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Insert(const Key &key, const Value &value) {
+    const size_t hash = hasher(key);
+    {
+        std::lock_guard lock(stripes[hash % stripe_count].mutex);
+        BucketArray *array = buckets.load(std::memory_order_relaxed);
+        std::atomic<Node *> &head = array->heads[hash % array->size];
+        for (std::atomic<Node *> *link = &head; Node *current = link->load(std::memory_order_relaxed);
+             link = &current->next) {
+            if (current->hash == hash && key_equal(current->key, key)) {
+                Node *replacement = new Node(key, value, hash, current->next.load(std::memory_order_relaxed));
+                link->store(replacement, std::memory_order_release);
+                EpochDomain::Instance().Retire(current);
+                return;
+            }
+        }
+        head.store(new Node(key, value, hash, head.load(std::memory_order_relaxed)), std::memory_order_release);
+    }
+    const size_t count = element_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count >= BucketCount() * load_refactor) {
+        Grow();
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+Value LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Get(const Key &key) const {
+    EpochGuard guard;
+    const Node *node = FindNode(key, hasher(key));
+    if (node == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return node->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::TryGet(const Key &key, Value &value) const {
+    EpochGuard guard;
+    const Node *node = FindNode(key, hasher(key));
+    if (node == nullptr) {
+        return false;
+    }
+    value = node->value;
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Remove(const Key &key) {
+    const size_t hash = hasher(key);
+    std::lock_guard lock(stripes[hash % stripe_count].mutex);
+    BucketArray *array = buckets.load(std::memory_order_relaxed);
+    for (std::atomic<Node *> *link = &array->heads[hash % array->size];
+         Node *current = link->load(std::memory_order_relaxed); link = &current->next) {
+        if (current->hash == hash && key_equal(current->key, key)) {
+            link->store(current->next.load(std::memory_order_relaxed), std::memory_order_release);
+            element_count.fetch_sub(1, std::memory_order_relaxed);
+            EpochDomain::Instance().Retire(current);
+            return;
+        }
+    }
+    throw std::out_of_range("No such key exists!\n");
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Clear() {
+    BucketArray *old_array;
+    {
+        AllStripesLock lock(*this);
+        old_array = buckets.load(std::memory_order_relaxed);
+        buckets.store(new BucketArray(old_array->size), std::memory_order_release);
+        element_count.store(0, std::memory_order_relaxed);
+    }
+    EpochDomain::Instance().Retire(old_array);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::ContainsKey(const Key &key) const {
+    EpochGuard guard;
+    return FindNode(key, hasher(key)) != nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::IsEmpty() const {
+    return Size() == 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Size() const {
+    return element_count.load(std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::BucketCount() const {
+    EpochGuard guard;
+    return buckets.load(std::memory_order_acquire)->size;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Resize() {
+    AllStripesLock lock(*this);
+    Rehash(buckets.load(std::memory_order_relaxed)->size * 2);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LockFreeReadHashTable<Key, Value, Hash, KeyEqual>::Show() const {
+    const BucketArray *array = buckets.load(std::memory_order_acquire);
+    for (size_t i = 0; i < array->size; ++i) {
+        std::cout << "Bucket number: " << i << ": ";
+        for (const Node *current = array->heads[i].load(std::memory_order_acquire); current != nullptr;
+             current = current->next.load(std::memory_order_acquire)) {
+            std::cout << "[" << current->key << ", " << current->value << "] -> ";
+        }
+        std::cout << "nullptr" << std::endl;
+    }
+}
+
+
+#endif //LOCKFREEREADHASHTABLE_H
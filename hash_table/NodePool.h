@@ -0,0 +1,199 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+/**
+ * Slab allocator for the nodes of a node-based container.
+ *
+ * The NodePool class hands out memory for objects of type T from large contiguous slabs and keeps the memory
+ * of destroyed objects in a free list, so it is reused by the next Create without going to malloc.
+ *
+ * Constructors:
+ *  - NodePool(): Initializes an empty pool. No slab is allocated before the first Create.
+ *  - NodePool(NodePool &&other) noexcept: Move constructor, transfers ownership of all slabs.
+ *  - The pool is not copyable: the objects it holds belong to the container that created them.
+ *
+ * Public Methods:
+ *  - T *Create(Args &&... args): Constructs an object from args in pooled memory and returns it.
+ *  - void Destroy(T *node): Destroys the object and puts its memory into the free list.
+ *  - void Absorb(NodePool &&other): Takes over all slabs of another pool together with the objects in them, which
+ *    then belong to this pool. The free memory of other is added to the free list; other is left empty.
+ *  - void Release(): Frees all slabs at once. Objects still alive are not destroyed, so the owner must either
+ *    destroy them first or only call it for trivially destructible objects.
+ *  - [[nodiscard]] size_t Capacity() const: Returns the number of objects that fit into the allocated slabs.
+ *  - [[nodiscard]] size_t BytesUsed() const: Returns the memory held by the slabs and the slab list.
+ *
+ * Time Complexity:
+ *  - Create: O(1), plus one allocation when the current slab is exhausted.
+ *  - Destroy: O(1).
+ *  - Absorb: O(number of slabs + free slots of other).
+ *  - Release: O(number of slabs).
+ *
+ * Features:
+ * - Every new slab holds twice as many objects as the previous one, up to kMaxSlabNodes.
+ * - Freed memory is reused in LIFO order, so a node removed and reinserted right away stays hot in the cache.
+ * - Absorb lets several threads create objects in pools of their own and hand them to one container afterwards,
+ *   without moving the objects.
+ */
+template<typename T>
+class NodePool {
+    union Slot {
+        Slot *next_free;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static constexpr size_t kMinSlabNodes = 32;
+    static constexpr size_t kMaxSlabNodes = 4096;
+
+    std::vector<std::unique_ptr<Slot[]> > slabs;
+    Slot *free_list = nullptr;
+    Slot *cursor = nullptr;
+    Slot *limit = nullptr;
+    size_t next_slab_nodes = kMinSlabNodes;
+    size_t capacity = 0;
+
+    Slot *AllocateSlot();
+
+public:
+    // --- Constructors ---
+    NodePool() = default;
+
+    NodePool(const NodePool &other) = delete;
+
+    NodePool(NodePool &&other) noexcept;
+
+    // --- Overload operators ---
+    NodePool &operator=(const NodePool &other) = delete;
+
+    NodePool &operator=(NodePool &&other) noexcept;
+
+    // --- Add element ---
+    template<typename... Args>
+    T *Create(Args &&... args);
+
+    // --- Remove element ---
+    void Destroy(T *node);
+
+    void Absorb(NodePool &&other);
+
+    void Release();
+
+    // --- Get size ---
+    [[nodiscard]] size_t Capacity() const;
+
+    [[nodiscard]] size_t BytesUsed() const;
+};
+
+template<typename T>
+typename NodePool<T>::Slot *NodePool<T>::AllocateSlot() {
+    if (free_list != nullptr) {
+        Slot *slot = free_list;
+        free_list = slot->next_free;
+        return slot;
+    }
+    if (cursor == limit) {
+        slabs.push_back(std::make_unique<Slot[]>(next_slab_nodes));
+        cursor = slabs.back().get();
+        limit = cursor + next_slab_nodes;
+        capacity += next_slab_nodes;
+        next_slab_nodes = next_slab_nodes * 2 > kMaxSlabNodes ? kMaxSlabNodes : next_slab_nodes * 2;
+    }
+    return cursor++;
+}
+
+template<typename T>
+NodePool<T>::NodePool(NodePool &&other) noexcept
+    : slabs(std::move(other.slabs)), free_list(other.free_list), cursor(other.cursor), limit(other.limit),
+      next_slab_nodes(other.next_slab_nodes), capacity(other.capacity) {
+    other.slabs.clear();
+    other.free_list = other.cursor = other.limit = nullptr;
+    other.next_slab_nodes = kMinSlabNodes;
+    other.capacity = 0;
+}
+
+template<typename T>
+NodePool<T> &NodePool<T>::operator=(NodePool &&other) noexcept {
+    if (this != &other) {
+        slabs = std::move(other.slabs);
+        free_list = other.free_list;
+        cursor = other.cursor;
+        limit = other.limit;
+        next_slab_nodes = other.next_slab_nodes;
+        capacity = other.capacity;
+
+        other.slabs.clear();
+        other.free_list = other.cursor = other.limit = nullptr;
+        other.next_slab_nodes = kMinSlabNodes;
+        other.capacity = 0;
+    }
+    return *this;
+}
+
+template<typename T>
+template<typename... Args>
+T *NodePool<T>::Create(Args &&... args) {
+    Slot *slot = AllocateSlot();
+    try {
+        return new(slot->storage) T(std::forward<Args>(args)...);
+    } catch (...) {
+        slot->next_free = free_list;
+        free_list = slot;
+        throw;
+    }
+}
+
+template<typename T>
+void NodePool<T>::Destroy(T *node) {
+    node->~T();
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    slot->next_free = free_list;
+    free_list = slot;
+}
+
+template<typename T>
+void NodePool<T>::Absorb(NodePool &&other) {
+    if (this == &other) {
+        return;
+    }
+    // The unused tail of the current slab of other goes to the free list, so no slot is lost.
+    for (Slot *slot = other.cursor; slot != other.limit; ++slot) {
+        slot->next_free = free_list;
+        free_list = slot;
+    }
+    while (other.free_list != nullptr) {
+        Slot *slot = other.free_list;
+        other.free_list = slot->next_free;
+        slot->next_free = free_list;
+        free_list = slot;
+    }
+    slabs.reserve(slabs.size() + other.slabs.size());
+    for (auto &slab: other.slabs) {
+        slabs.push_back(std::move(slab));
+    }
+    capacity += other.capacity;
+    other.Release();
+}
+
+template<typename T>
+void NodePool<T>::Release() {
+    slabs.clear();
+    free_list = cursor = limit = nullptr;
+    next_slab_nodes = kMinSlabNodes;
+    capacity = 0;
+}
+
+template<typename T>
+size_t NodePool<T>::Capacity() const {
+    return capacity;
+}
+
+template<typename T>
+size_t NodePool<T>::BytesUsed() const {
+    return capacity * sizeof(Slot) + slabs.capacity() * sizeof(slabs[0]);
+}
+
+
+#endif //NODEPOOL_H
@@ -0,0 +1,670 @@
+#ifndef PERSISTENTHASHTABLE_H
+#define PERSISTENTHASHTABLE_H
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "HashMix.h"
+#include "SeededHash.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" with copy-on-write snapshots.
+ *
+ * The PersistentHashTable class is a chained hash table whose bucket arrays and chain nodes are shared between copies
+ * through reference counts. Copying a table, or taking a Snapshot of it, only shares its root; a writer then copies
+ * the parts it changes: the root, the chunk of kChunkSize buckets that holds the key and the chain nodes in front of
+ * it. Everything else stays shared, so a snapshot costs O(1) and the writes after it cost little more than usual.
+ *
+ * Constructors:
+ *  - PersistentHashTable(size_t table_size = 64, float load_factor = 0.75, const Hash &hash = Hash(),
+ *    const KeyEqual &equal = KeyEqual()): Initializes an empty table. The number of buckets is rounded up to a power
+ *    of two and to at least kChunkSize.
+ *  - PersistentHashTable(const PersistentHashTable &other): Copy constructor, O(1): shares the contents of other.
+ *  - PersistentHashTable(PersistentHashTable &&other) noexcept: Move constructor, leaves other empty.
+ *
+ * Destructor:
+ *  - ~PersistentHashTable(): Releases the contents; the parts still shared with other copies stay alive.
+ *
+ * Overloaded Operators:
+ *  - PersistentHashTable& operator=(const PersistentHashTable &other): Copy assignment operator, O(1).
+ *  - PersistentHashTable& operator=(PersistentHashTable &&other) noexcept: Move assignment operator.
+ *
+ * Public Methods:
+ *  - PersistentHashTable Snapshot() const: Returns a copy that later writes to this table do not change, in O(1).
+ *  - void Insert(const Key &key, const Value &value) / void Insert(Key &&key, Value &&value): Inserts or overwrites the
+ *    pair.
+ *  - const Value *Find(const Key &key) const: Returns a pointer to the value, or nullptr if the key is not found.
+ *  - const Value &Get(const Key &key) const: Same as Find, but throws an exception if the key is not found.
+ *  - bool ContainsKey(const Key &key) const: Returns true if the table contains the key.
+ *  - void Remove(const Key &key): Removes the pair, throws an exception if the key is not found.
+ *  - void Clear(): Removes all pairs.
+ *  - [[nodiscard]] bool IsEmpty() const, [[nodiscard]] size_t Size() const, [[nodiscard]] size_t BucketCount() const.
+ *  - Iterator Begin() const / Iterator End() const (and begin() / end() for range-based for): Read-only iteration
+ *    over the pairs in bucket order. A write to the table invalidates its iterators; a snapshot is never written.
+ *  - void Show() const: Prints the contents of the buckets.
+ *
+ * Private Methods:
+ *  - static void Retain(T *shared) / static void Release(Node *node) / Release(Chunk *chunk) / Release(Root *root):
+ *    Reference counting. A node holds a reference to the next node of its chain, a chunk to the first nodes of its
+ *    buckets and a root to its chunks; the last Release of a part frees it.
+ *  - static Root *NewRoot(size_t bucket_count): Allocates a root with empty chunks.
+ *  - void MakeRootUnique() / Chunk *UniqueChunk(size_t bucket): Copy the root or a chunk shared with a snapshot.
+ *  - Node *UniquePath(Node **link, size_t depth): Copies the shared nodes of a chain up to the given depth.
+ *  - const Node *Locate(const Key &key, size_t hash, size_t &depth) const: Finds the node of a key and its depth.
+ *  - void Rehash(size_t bucket_count): Moves the pairs into a new root with bucket_count buckets.
+ *  - void InsertImpl(K &&key, V &&value): Shared body of the Insert overloads.
+ *
+ * Time Complexity:
+ *  - Snapshot, copy constructor, copy assignment: O(1).
+ *  - Find, Get, ContainsKey: O(1) on average.
+ *  - Insert, Remove: O(1) on average. The first write after a snapshot also copies the root, O(n / kChunkSize), and
+ *    the first write to every chunk copies that chunk, O(kChunkSize).
+ *  - Rehash: O(n); the nodes no snapshot shares are relinked, the others are copied.
+ *
+ * Features:
+ * - Reference counts are atomic and the shared parts are never written, so snapshots can be handed to other threads
+ *   and read there while the original keeps changing. A table object itself is not synchronized: each thread needs
+ *   a copy of its own.
+ * - When nothing is shared (no snapshot is alive) every write happens in place, as in a plain chained table.
+ */
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key> >
+class PersistentHashTable {
+    static constexpr size_t kChunkSize = 64;
+
+    struct Node {
+        std::atomic<size_t> references{1};
+        size_t hash;
+        Key key;
+        Value value;
+        Node *next;
+
+        template<typename K, typename V>
+        Node(const size_t hash, K &&key, V &&value, Node *next): hash(hash), key(std::forward<K>(key)),
+                                                                 value(std::forward<V>(value)), next(next) {
+        }
+    };
+
+    struct Chunk {
+        std::atomic<size_t> references{1};
+        Node *buckets[kChunkSize] = {};
+    };
+
+    struct Root {
+        std::atomic<size_t> references{1};
+        size_t bucket_count;
+        size_t size = 0;
+        std::unique_ptr<Chunk *[]> chunks;
+
+        explicit Root(const size_t bucket_count): bucket_count(bucket_count),
+                                                  chunks(new Chunk *[bucket_count / kChunkSize]()) {
+        }
+    };
+
+    Root *root = nullptr;
+    size_t initial_size;
+    float load_factor;
+    Hash hasher;
+    KeyEqual key_equal;
+
+    template<typename T>
+    static void Retain(T *shared);
+
+    static void Release(Node *node);
+
+    static void Release(Chunk *chunk);
+
+    static void Release(Root *root);
+
+    static Root *NewRoot(size_t bucket_count);
+
+    void MakeRootUnique();
+
+    Chunk *UniqueChunk(size_t bucket);
+
+    Node *UniquePath(Node **link, size_t depth);
+
+    const Node *Locate(const Key &key, size_t hash, size_t &depth) const;
+
+    void Rehash(size_t bucket_count);
+
+    template<typename K, typename V>
+    void InsertImpl(K &&key, V &&value);
+
+public:
+    struct Entry {
+        const Key &key;
+        const Value &value;
+    };
+
+    class Iterator {
+        const Root *root;
+        size_t bucket;
+        const Node *node;
+
+        void SkipEmptyBuckets();
+
+    public:
+        struct EntryPointer {
+            Entry entry;
+
+            const Entry *operator->() const {
+                return &entry;
+            }
+        };
+
+        Iterator(const Root *root, size_t bucket, const Node *node);
+
+        bool operator!=(const Iterator &other) const;
+
+        bool operator==(const Iterator &other) const;
+
+        Iterator &operator++();
+
+        Iterator operator++(int);
+
+        Entry operator*() const;
+
+        EntryPointer operator->() const;
+    };
+
+    // --- Constructors ---
+    explicit PersistentHashTable(size_t table_size = kChunkSize, float load_factor = 0.75, const Hash &hash = Hash(),
+                                 const KeyEqual &equal = KeyEqual());
+
+    PersistentHashTable(const PersistentHashTable &other);
+
+    PersistentHashTable(PersistentHashTable &&other) noexcept;
+
+    // --- Destructor ---
+    ~PersistentHashTable();
+
+    // --- Overload operators ---
+    PersistentHashTable &operator=(const PersistentHashTable &other);
+
+    PersistentHashTable &operator=(PersistentHashTable &&other) noexcept;
+
+    // --- Snapshot ---
+    PersistentHashTable Snapshot() const;
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    void Insert(Key &&key, Value &&value);
+
+    // --- Get element ---
+    const Value *Find(const Key &key) const;
+
+    const Value &Get(const Key &key) const;
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key) const;
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Check is empty ---
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t BucketCount() const;
+
+    // --- Iteration ---
+    Iterator Begin() const;
+
+    Iterator End() const;
+
+    Iterator begin() const;
+
+    Iterator end() const;
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename T>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Retain(T *shared) {
+    if (shared != nullptr) {
+        shared->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Release(Node *node) {
+    // Iterative, so that freeing a long chain does not recurse.
+    while (node != nullptr && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Node *next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Release(Chunk *chunk) {
+    if (chunk != nullptr && chunk->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        for (Node *head: chunk->buckets) {
+            Release(head);
+        }
+        delete chunk;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Release(Root *root) {
+    if (root != nullptr && root->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        for (size_t i = 0; i < root->bucket_count / kChunkSize; ++i) {
+            Release(root->chunks[i]);
+        }
+        delete root;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Root *
+PersistentHashTable<Key, Value, Hash, KeyEqual>::NewRoot(const size_t bucket_count) {
+    auto created = std::make_unique<Root>(bucket_count);
+    for (size_t i = 0; i < bucket_count / kChunkSize; ++i) {
+        created->chunks[i] = new Chunk();
+    }
+    return created.release();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::MakeRootUnique() {
+    if (root == nullptr) {
+        root = NewRoot(initial_size);
+        return;
+    }
+    if (root->references.load(std::memory_order_acquire) == 1) {
+        return;
+    }
+    auto copy = std::make_unique<Root>(root->bucket_count);
+    copy->size = root->size;
+    for (size_t i = 0; i < root->bucket_count / kChunkSize; ++i) {
+        copy->chunks[i] = root->chunks[i];
+        Retain(copy->chunks[i]);
+    }
+    Release(root);
+    root = copy.release();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Chunk *
+PersistentHashTable<Key, Value, Hash, KeyEqual>::UniqueChunk(const size_t bucket) {
+    Chunk *&chunk = root->chunks[bucket / kChunkSize];
+    if (chunk->references.load(std::memory_order_acquire) != 1) {
+        auto *copy = new Chunk();
+        for (size_t i = 0; i < kChunkSize; ++i) {
+            copy->buckets[i] = chunk->buckets[i];
+            Retain(copy->buckets[i]);
+        }
+        Release(chunk);
+        chunk = copy;
+    }
+    return chunk;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Node *
+PersistentHashTable<Key, Value, Hash, KeyEqual>::UniquePath(Node **link, const size_t depth) {
+    // The container of link is unique, so a node with a single reference is unique too. Once a shared node is copied,
+    // the nodes behind it gain a reference and are copied in turn.
+    for (size_t i = 0;; ++i) {
+        Node *node = *link;
+        if (node->references.load(std::memory_order_acquire) != 1) {
+            Node *copy = new Node(node->hash, node->key, node->value, node->next);
+            Retain(copy->next);
+            *link = copy;
+            Release(node);
+            node = copy;
+        }
+        if (i == depth) {
+            return node;
+        }
+        link = &node->next;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Node *
+PersistentHashTable<Key, Value, Hash, KeyEqual>::Locate(const Key &key, const size_t hash, size_t &depth) const {
+    if (root == nullptr) {
+        return nullptr;
+    }
+    const size_t bucket = MixHash(hash) & (root->bucket_count - 1);
+    depth = 0;
+    for (const Node *node = root->chunks[bucket / kChunkSize]->buckets[bucket % kChunkSize]; node != nullptr;
+         node = node->next, ++depth) {
+        if (node->hash == hash && key_equal(node->key, key)) {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Rehash(const size_t bucket_count) {
+    const size_t old_count = root->bucket_count;
+    const bool root_owned = root->references.load(std::memory_order_acquire) == 1;
+    // Pass 1 does everything that may throw: allocating the new root and copying the shared nodes. The copies of the
+    // shared tail of every old chain are kept in a list of their own, and the length of its owned head is recorded:
+    // a snapshot released by another thread meanwhile must not change the split.
+    std::vector<Node *> copies(old_count, nullptr);
+    std::vector<size_t> owned_length(old_count, 0);
+    Root *created = NewRoot(bucket_count);
+    try {
+        for (size_t i = 0; i < old_count; ++i) {
+            const Chunk *chunk = root->chunks[i / kChunkSize];
+            bool owned = root_owned && chunk->references.load(std::memory_order_acquire) == 1;
+            for (const Node *node = chunk->buckets[i % kChunkSize]; node != nullptr; node = node->next) {
+                owned = owned && node->references.load(std::memory_order_acquire) == 1;
+                if (owned) {
+                    ++owned_length[i];
+                } else {
+                    copies[i] = new Node(node->hash, node->key, node->value, copies[i]);
+                }
+            }
+        }
+    } catch (...) {
+        for (Node *copy: copies) {
+            Release(copy);
+        }
+        Release(created);
+        throw;
+    }
+    // Pass 2 can not fail: the owned nodes are relinked and the copies take the place of the shared ones.
+    const auto link = [created, bucket_count](Node *node) {
+        const size_t bucket = MixHash(node->hash) & (bucket_count - 1);
+        Node *&head = created->chunks[bucket / kChunkSize]->buckets[bucket % kChunkSize];
+        node->next = head;
+        head = node;
+    };
+    for (size_t i = 0; i < old_count; ++i) {
+        if (owned_length[i] != 0) {
+            Node *&head = root->chunks[i / kChunkSize]->buckets[i % kChunkSize];
+            Node *node = head;
+            head = nullptr;
+            for (size_t j = 0; j < owned_length[i]; ++j) {
+                Node *next = node->next;
+                link(node);
+                node = next;
+            }
+            // The rest of the chain is shared: drop the reference the owned head held on it.
+            Release(node);
+        }
+        Node *copy = copies[i];
+        while (copy != nullptr) {
+            Node *next = copy->next;
+            link(copy);
+            copy = next;
+        }
+    }
+    created->size = root->size;
+    Release(root);
+    root = created;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K, typename V>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::InsertImpl(K &&key, V &&value) {
+    const size_t hash = hasher(key);
+    size_t depth = 0;
+    if (Locate(key, hash, depth) != nullptr) {
+        MakeRootUnique();
+        const size_t bucket = MixHash(hash) & (root->bucket_count - 1);
+        Chunk *chunk = UniqueChunk(bucket);
+        Node *node = UniquePath(&chunk->buckets[bucket % kChunkSize], depth);
+        node->value = std::forward<V>(value);
+        return;
+    }
+    // Rehash leaves a root of its own, so a shared root is not copied first.
+    if (root != nullptr &&
+        static_cast<float>(root->size + 1) > static_cast<float>(root->bucket_count) * load_factor) {
+        Rehash(root->bucket_count * 2);
+    } else {
+        MakeRootUnique();
+    }
+    const size_t bucket = MixHash(hash) & (root->bucket_count - 1);
+    Chunk *chunk = UniqueChunk(bucket);
+    Node *&head = chunk->buckets[bucket % kChunkSize];
+    // The new node takes over the reference the chunk held on the old head.
+    head = new Node(hash, std::forward<K>(key), std::forward<V>(value), head);
+    ++root->size;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+PersistentHashTable<Key, Value, Hash, KeyEqual>::PersistentHashTable(const size_t table_size, const float load_factor,
+                                                                     const Hash &hash, const KeyEqual &equal)
+    : initial_size(kChunkSize), load_factor(load_factor > 0 ? load_factor : 0.75f), hasher(hash), key_equal(equal) {
+    while (initial_size < table_size) {
+        initial_size *= 2;
+    }
+    root = NewRoot(initial_size);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+PersistentHashTable<Key, Value, Hash, KeyEqual>::PersistentHashTable(const PersistentHashTable &other)
+    : root(other.root), initial_size(other.initial_size), load_factor(other.load_factor), hasher(other.hasher),
+      key_equal(other.key_equal) {
+    Retain(root);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+PersistentHashTable<Key, Value, Hash, KeyEqual>::PersistentHashTable(PersistentHashTable &&other) noexcept
+    : root(other.root), initial_size(other.initial_size), load_factor(other.load_factor),
+      hasher(std::move(other.hasher)), key_equal(std::move(other.key_equal)) {
+    other.root = nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+PersistentHashTable<Key, Value, Hash, KeyEqual>::~PersistentHashTable() {
+    Release(root);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+PersistentHashTable<Key, Value, Hash, KeyEqual> &
+PersistentHashTable<Key, Value, Hash, KeyEqual>::operator=(const PersistentHashTable &other) {
+    if (this != &other) {
+        Retain(other.root);
+        Release(root);
+        root = other.root;
+        initial_size = other.initial_size;
+        load_factor = other.load_factor;
+        hasher = other.hasher;
+        key_equal = other.key_equal;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+PersistentHashTable<Key, Value, Hash, KeyEqual> &
+PersistentHashTable<Key, Value, Hash, KeyEqual>::operator=(PersistentHashTable &&other) noexcept {
+    if (this != &other) {
+        Release(root);
+        root = other.root;
+        other.root = nullptr;
+        initial_size = other.initial_size;
+        load_factor = other.load_factor;
+        hasher = std::move(other.hasher);
+        key_equal = std::move(other.key_equal);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+PersistentHashTable<Key, Value, Hash, KeyEqual> PersistentHashTable<Key, Value, Hash, KeyEqual>::Snapshot() const {
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Insert(const Key &key, const Value &value) {
+    InsertImpl(key, value);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Insert(Key &&key, Value &&value) {
+    InsertImpl(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const Value *PersistentHashTable<Key, Value, Hash, KeyEqual>::Find(const Key &key) const {
+    size_t depth = 0;
+    const Node *node = Locate(key, hasher(key), depth);
+    return node != nullptr ? &node->value : nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+const Value &PersistentHashTable<Key, Value, Hash, KeyEqual>::Get(const Key &key) const {
+    const Value *value = Find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool PersistentHashTable<Key, Value, Hash, KeyEqual>::ContainsKey(const Key &key) const {
+    return Find(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Remove(const Key &key) {
+    const size_t hash = hasher(key);
+    size_t depth = 0;
+    if (Locate(key, hash, depth) == nullptr) {
+        throw std::out_of_range("No such key exists!\n");
+    }
+    MakeRootUnique();
+    const size_t bucket = MixHash(hash) & (root->bucket_count - 1);
+    Node **link = &UniqueChunk(bucket)->buckets[bucket % kChunkSize];
+    if (depth != 0) {
+        link = &UniquePath(link, depth - 1)->next;
+    }
+    Node *removed = *link;
+    *link = removed->next;
+    Retain(removed->next);
+    Release(removed);
+    --root->size;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Clear() {
+    Release(root);
+    root = nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool PersistentHashTable<Key, Value, Hash, KeyEqual>::IsEmpty() const {
+    return Size() == 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t PersistentHashTable<Key, Value, Hash, KeyEqual>::Size() const {
+    return root != nullptr ? root->size : 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t PersistentHashTable<Key, Value, Hash, KeyEqual>::BucketCount() const {
+    return root != nullptr ? root->bucket_count : 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::SkipEmptyBuckets() {
+    while (node == nullptr && root != nullptr && ++bucket < root->bucket_count) {
+        node = root->chunks[bucket / kChunkSize]->buckets[bucket % kChunkSize];
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::Iterator(const Root *root, const size_t bucket,
+                                                                    const Node *node)
+    : root(root), bucket(bucket), node(node) {
+    SkipEmptyBuckets();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator!=(const Iterator &other) const {
+    return node != other.node;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator==(const Iterator &other) const {
+    return node == other.node;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator &
+PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator++() {
+    node = node->next;
+    SkipEmptyBuckets();
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator
+PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator++(int) {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Entry
+PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator*() const {
+    return Entry{node->key, node->value};
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::EntryPointer
+PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator::operator->() const {
+    return EntryPointer{Entry{node->key, node->value}};
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator
+PersistentHashTable<Key, Value, Hash, KeyEqual>::Begin() const {
+    if (root == nullptr) {
+        return End();
+    }
+    return Iterator(root, 0, root->chunks[0]->buckets[0]);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator
+PersistentHashTable<Key, Value, Hash, KeyEqual>::End() const {
+    return Iterator(nullptr, 0, nullptr);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator
+PersistentHashTable<Key, Value, Hash, KeyEqual>::begin() const {
+    return Begin();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentHashTable<Key, Value, Hash, KeyEqual>::Iterator
+PersistentHashTable<Key, Value, Hash, KeyEqual>::end() const {
+    return End();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentHashTable<Key, Value, Hash, KeyEqual>::Show() const {
+    for (size_t i = 0; i < BucketCount(); ++i) {
+        std::cout << "Bucket number: " << i << ": ";
+        for (const Node *node = root->chunks[i / kChunkSize]->buckets[i % kChunkSize]; node != nullptr;
+             node = node->next) {
+            std::cout << "[" << node->key << ", " << node->value << "] -> ";
+        }
+        std::cout << "nullptr" << std::endl;
+    }
+}
+
+
+#endif //PERSISTENTHASHTABLE_H
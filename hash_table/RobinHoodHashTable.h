@@ -0,0 +1,424 @@
+#ifndef ROBINHOODHASHTABLE_H
+#define ROBINHOODHASHTABLE_H
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "HashMix.h"
+#include "SeededHash.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" with Robin Hood open addressing.
+ *
+ * The RobinHoodHashTable class provides the same surface as HashTable, but keeps the entries in a flat slot array
+ * probed linearly. Every slot remembers its probe distance: how far it is from the slot its hash points to.
+ *
+ * Constructors:
+ *  - RobinHoodHashTable(size_t capacity = 16, float load_factor = 0.875): Initializes an empty table with at least
+ *    the given number of slots and the given maximum load factor.
+ *  - RobinHoodHashTable(const RobinHoodHashTable &other): Copy constructor, creates a deep copy of another table.
+ *  - RobinHoodHashTable(RobinHoodHashTable &&other) noexcept: Move constructor, transfers ownership of the slots.
+ *
+ * Destructor:
+ *  - ~RobinHoodHashTable(): Destroys all stored entries and releases the slot arrays.
+ *
+ * Overloaded Operators:
+ *  - RobinHoodHashTable& operator=(const RobinHoodHashTable &other): Copy assignment operator.
+ *  - RobinHoodHashTable& operator=(RobinHoodHashTable &&other) noexcept: Move assignment operator.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value): Inserts a key-value pair, overwriting the value of an existing key.
+ *  - Value &Get(const Key &key): Retrieves the value associated with the key. Throws an exception if the key is not found.
+ *  - void Remove(const Key &key): Removes the key with backward-shift deletion. Throws if the key is not found.
+ *  - void Clear(): Removes all key-value pairs, keeping the allocated capacity.
+ *  - bool ContainsKey(const Key &key): Returns true if the table contains the key, false otherwise.
+ *  - [[nodiscard]] bool IsEmpty() const: Returns true if the table is empty.
+ *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs in the table.
+ *  - [[nodiscard]] size_t Capacity() const: Returns the number of slots in the table.
+ *  - [[nodiscard]] size_t MaxProbeLength() const: Returns the longest probe distance of the stored entries.
+ *  - void Resize(): Doubles the number of slots and reinserts every entry.
+ *
+ * Time Complexity:
+ *  - Insert, Get, Remove, ContainsKey: O(1) on average; the probe length stays O(log n) with high probability.
+ *  - Clear: O(capacity).
+ *  - Resize: O(n + capacity).
+ *
+ * Features:
+ * - Insertion takes the slot of any entry that is closer to its home slot than the entry being inserted, and goes on
+ *   inserting the displaced one ("take from the rich"). This keeps the probe distances of all entries close to each
+ *   other, which bounds the variance of the lookup time.
+ * - A lookup stops as soon as it meets an entry with a smaller probe distance than its own: the key would have taken
+ *   that slot if it were present.
+ * - Remove shifts the following entries of the probe run one slot back instead of leaving a tombstone, so long
+ *   insert/remove churn does not degrade the table.
+ * - Home slots come from a SeededHash (see SeededHash.h); copies and moves keep its seed, which the stored probe
+ *   distances depend on.
+ */
+template<typename Key, typename Value>
+class RobinHoodHashTable {
+    struct Slot {
+        Key key;
+        Value value;
+
+        Slot(const Key &key, const Value &value) : key(key), value(value) {
+        }
+    };
+
+    // Probe distance plus one; 0 marks an empty slot.
+    using Distance = uint16_t;
+
+    static constexpr Distance kMaxDistance = UINT16_MAX;
+
+    Slot *slots;
+    Distance *distances;
+    size_t capacity;
+    size_t element_count;
+    float load_refactor;
+    SeededHash<Key> hasher;
+
+    static size_t NormalizeCapacity(size_t capacity);
+
+    [[nodiscard]] size_t HashFunction(const Key &key) const;
+
+    void Allocate(size_t new_capacity);
+
+    void Deallocate();
+
+    void DestroySlots();
+
+    [[nodiscard]] size_t FindIndex(const Key &key) const;
+
+    bool Place(Slot &&slot);
+
+    void Rehash(size_t new_capacity);
+
+    void CopyFrom(const RobinHoodHashTable &other);
+
+public:
+    // --- Constructors ---
+    explicit RobinHoodHashTable(size_t capacity = 16, float load_factor = 0.875);
+
+    RobinHoodHashTable(const RobinHoodHashTable &other);
+
+    RobinHoodHashTable(RobinHoodHashTable &&other) noexcept;
+
+    // --- Overload operators ---
+    RobinHoodHashTable &operator=(const RobinHoodHashTable &other);
+
+    RobinHoodHashTable &operator=(RobinHoodHashTable &&other) noexcept;
+
+    // --- Destructors ---
+    ~RobinHoodHashTable();
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    // --- Get element ---
+    Value &Get(const Key &key);
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key);
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t Capacity() const;
+
+    [[nodiscard]] size_t MaxProbeLength() const;
+
+    // --- Change size in hash table ---
+    void Resize();
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value>
+size_t RobinHoodHashTable<Key, Value>::NormalizeCapacity(const size_t capacity) {
+    size_t result = 8;
+    while (result < capacity) {
+        result *= 2;
+    }
+    return result;
+}
+
+template<typename Key, typename Value>
+size_t RobinHoodHashTable<Key, Value>::HashFunction(const Key &key) const {
+    return MixHash(hasher(key)) & (capacity - 1);
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::Allocate(const size_t new_capacity) {
+    distances = new Distance[new_capacity]();
+    slots = std::allocator<Slot>().allocate(new_capacity);
+    capacity = new_capacity;
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::Deallocate() {
+    if (slots != nullptr) {
+        std::allocator<Slot>().deallocate(slots, capacity);
+    }
+    delete[] distances;
+    slots = nullptr;
+    distances = nullptr;
+    capacity = 0;
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::DestroySlots() {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (distances[i] != 0) {
+            slots[i].~Slot();
+            distances[i] = 0;
+        }
+    }
+}
+
+template<typename Key, typename Value>
+size_t RobinHoodHashTable<Key, Value>::FindIndex(const Key &key) const {
+    if (capacity == 0) {
+        return 0;
+    }
+    const size_t mask = capacity - 1;
+    size_t index = HashFunction(key);
+    for (size_t distance = 1; distance <= distances[index]; ++distance) {
+        // An entry closer to its home than the key is to its own means the key is not in the table.
+        if (distances[index] == distance && slots[index].key == key) {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+    return capacity;
+}
+
+template<typename Key, typename Value>
+bool RobinHoodHashTable<Key, Value>::Place(Slot &&slot) {
+    const size_t mask = capacity - 1;
+    size_t index = HashFunction(slot.key);
+    Distance distance = 1;
+    Slot carried(std::move(slot));
+    while (distances[index] != 0) {
+        if (distances[index] < distance) {
+            std::swap(carried.key, slots[index].key);
+            std::swap(carried.value, slots[index].value);
+            std::swap(distance, distances[index]);
+        }
+        if (distance == kMaxDistance) {
+            // Only a degenerate hash gets here; the caller grows the table and places the carried entry again.
+            slot = std::move(carried);
+            return false;
+        }
+        index = (index + 1) & mask;
+        ++distance;
+    }
+    new(slots + index) Slot(std::move(carried));
+    distances[index] = distance;
+    return true;
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::Rehash(const size_t new_capacity) {
+    Slot *old_slots = slots;
+    Distance *old_distances = distances;
+    const size_t old_capacity = capacity;
+
+    Allocate(new_capacity);
+    for (size_t i = 0; i < old_capacity; ++i) {
+        if (old_distances[i] != 0) {
+            Slot slot(std::move(old_slots[i]));
+            old_slots[i].~Slot();
+            while (!Place(std::move(slot))) {
+                Rehash(capacity * 2);
+            }
+        }
+    }
+
+    if (old_slots != nullptr) {
+        std::allocator<Slot>().deallocate(old_slots, old_capacity);
+    }
+    delete[] old_distances;
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::CopyFrom(const RobinHoodHashTable &other) {
+    Allocate(other.capacity);
+    for (size_t i = 0; i < other.capacity; ++i) {
+        if (other.distances[i] != 0) {
+            new(slots + i) Slot(other.slots[i]);
+            distances[i] = other.distances[i];
+        }
+    }
+    element_count = other.element_count;
+    load_refactor = other.load_refactor;
+    hasher = other.hasher;
+}
+
+template<typename Key, typename Value>
+RobinHoodHashTable<Key, Value>::RobinHoodHashTable(const size_t capacity, const float load_factor)
+    : slots(nullptr), distances(nullptr), capacity(0), element_count(0), load_refactor(load_factor) {
+    Allocate(NormalizeCapacity(capacity));
+}
+
+template<typename Key, typename Value>
+RobinHoodHashTable<Key, Value>::RobinHoodHashTable(const RobinHoodHashTable &other)
+    : slots(nullptr), distances(nullptr), capacity(0), element_count(0), load_refactor(other.load_refactor) {
+    CopyFrom(other);
+}
+
+template<typename Key, typename Value>
+RobinHoodHashTable<Key, Value>::RobinHoodHashTable(RobinHoodHashTable &&other) noexcept
+    : slots(other.slots), distances(other.distances), capacity(other.capacity), element_count(other.element_count),
+      load_refactor(other.load_refactor), hasher(other.hasher) {
+    other.slots = nullptr;
+    other.distances = nullptr;
+    other.capacity = 0;
+    other.element_count = 0;
+}
+
+template<typename Key, typename Value>
+RobinHoodHashTable<Key, Value> &RobinHoodHashTable<Key, Value>::operator=(const RobinHoodHashTable &other) {
+    if (this != &other) {
+        DestroySlots();
+        Deallocate();
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value>
+RobinHoodHashTable<Key, Value> &RobinHoodHashTable<Key, Value>::operator=(RobinHoodHashTable &&other) noexcept {
+    if (this != &other) {
+        DestroySlots();
+        Deallocate();
+        slots = other.slots;
+        distances = other.distances;
+        capacity = other.capacity;
+        element_count = other.element_count;
+        load_refactor = other.load_refactor;
+        hasher = other.hasher;
+
+        other.slots = nullptr;
+        other.distances = nullptr;
+        other.capacity = 0;
+        other.element_count = 0;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value>
+RobinHoodHashTable<Key, Value>::~RobinHoodHashTable() {
+    DestroySlots();
+    Deallocate();
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::Insert(const Key &key, const Value &value) {
+    const size_t index = FindIndex(key);
+    if (index != capacity) {
+        slots[index].value = value;
+        return;
+    }
+    if (capacity == 0 || element_count + 1 > capacity * load_refactor) {
+        Resize();
+    }
+    Slot slot(key, value);
+    while (!Place(std::move(slot))) {
+        Resize();
+    }
+    ++element_count;
+}
+
+template<typename Key, typename Value>
+Value &RobinHoodHashTable<Key, Value>::Get(const Key &key) {
+    const size_t index = FindIndex(key);
+    if (index == capacity) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return slots[index].value;
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::Remove(const Key &key) {
+    size_t index = FindIndex(key);
+    if (index == capacity) {
+        throw std::out_of_range("No such key exists!\n");
+    }
+    const size_t mask = capacity - 1;
+    slots[index].~Slot();
+    // Backward shift: pull every following entry of the run one slot closer to its home.
+    size_t next = (index + 1) & mask;
+    while (distances[next] > 1) {
+        new(slots + index) Slot(std::move(slots[next]));
+        slots[next].~Slot();
+        distances[index] = distances[next] - 1;
+        index = next;
+        next = (next + 1) & mask;
+    }
+    distances[index] = 0;
+    --element_count;
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::Clear() {
+    DestroySlots();
+    element_count = 0;
+}
+
+template<typename Key, typename Value>
+bool RobinHoodHashTable<Key, Value>::ContainsKey(const Key &key) {
+    return FindIndex(key) != capacity;
+}
+
+template<typename Key, typename Value>
+bool RobinHoodHashTable<Key, Value>::IsEmpty() const {
+    return element_count == 0;
+}
+
+template<typename Key, typename Value>
+size_t RobinHoodHashTable<Key, Value>::Size() const {
+    return element_count;
+}
+
+template<typename Key, typename Value>
+size_t RobinHoodHashTable<Key, Value>::Capacity() const {
+    return capacity;
+}
+
+template<typename Key, typename Value>
+size_t RobinHoodHashTable<Key, Value>::MaxProbeLength() const {
+    size_t longest = 0;
+    for (size_t i = 0; i < capacity; ++i) {
+        if (distances[i] > longest) {
+            longest = distances[i];
+        }
+    }
+    return longest == 0 ? 0 : longest - 1;
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::Resize() {
+    Rehash(capacity == 0 ? 8 : capacity * 2);
+}
+
+template<typename Key, typename Value>
+void RobinHoodHashTable<Key, Value>::Show() const {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (distances[i] != 0) {
+            std::cout << "Slot number: " << i << " (probe distance " << distances[i] - 1 << "): [" << slots[i].key
+                    << ", " << slots[i].value << "]" << std::endl;
+        }
+    }
+}
+
+
+#endif //ROBINHOODHASHTABLE_H
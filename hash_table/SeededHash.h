@@ -0,0 +1,180 @@
+#ifndef SEEDEDHASH_H
+#define SEEDEDHASH_H
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*
+ * Keyed hashing in the style of wyhash: the input is folded with 64x64->128 bit multiplications ("mum") of the data
+ * xor-ed with the seed, so two keys that collide under one seed are unrelated under another. An attacker who can not
+ * observe the seed can not build a set of keys that fall into one bucket.
+ */
+namespace seeded_hash {
+    constexpr uint64_t kSecret[3] = {0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL};
+
+    // Folds the 128 bit product of a and b into 64 bits.
+    inline uint64_t Mum(const uint64_t a, const uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+        const __uint128_t product = static_cast<__uint128_t>(a) * b;
+        return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+        const uint64_t a_high = a >> 32, a_low = static_cast<uint32_t>(a);
+        const uint64_t b_high = b >> 32, b_low = static_cast<uint32_t>(b);
+        const uint64_t high = a_high * b_high, middle_a = a_high * b_low, middle_b = a_low * b_high, low = a_low * b_low;
+        const uint64_t cross = (low >> 32) + static_cast<uint32_t>(middle_a) + static_cast<uint32_t>(middle_b);
+        const uint64_t product_high = high + (middle_a >> 32) + (middle_b >> 32) + (cross >> 32);
+        const uint64_t product_low = (cross << 32) | static_cast<uint32_t>(low);
+        return product_low ^ product_high;
+#endif
+    }
+
+    inline uint64_t Read64(const char *data) {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t Read32(const char *data) {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t HashInteger(const uint64_t key, const uint64_t seed) {
+        return Mum(Mum(key ^ seed ^ kSecret[0], key ^ kSecret[1]) ^ seed, kSecret[2] ^ key);
+    }
+
+    inline uint64_t HashBytes(const char *data, const size_t length, uint64_t seed) {
+        seed ^= Mum(seed ^ kSecret[0], kSecret[1]);
+        uint64_t a = 0;
+        uint64_t b = 0;
+        if (length <= 16) {
+            if (length >= 4) {
+                // Two possibly overlapping pairs of 32 bit words cover every length from 4 to 16.
+                const size_t shift = (length >> 3) << 2;
+                a = (Read32(data) << 32) | Read32(data + shift);
+                b = (Read32(data + length - 4) << 32) | Read32(data + length - 4 - shift);
+            } else if (length > 0) {
+                a = (static_cast<uint64_t>(static_cast<unsigned char>(data[0])) << 16) |
+                    (static_cast<uint64_t>(static_cast<unsigned char>(data[length >> 1])) << 8) |
+                    static_cast<unsigned char>(data[length - 1]);
+            }
+        } else {
+            size_t rest = length;
+            while (rest > 16) {
+                seed = Mum(Read64(data) ^ kSecret[1], Read64(data + 8) ^ seed);
+                data += 16;
+                rest -= 16;
+            }
+            a = Read64(data + rest - 16);
+            b = Read64(data + rest - 8);
+        }
+        return Mum(Mum(a ^ kSecret[1], b ^ seed) ^ kSecret[0] ^ length, kSecret[1] ^ seed);
+    }
+}
+
+/*
+ * RandomSeed:
+ * - Returns a fresh unpredictable seed. The random device is read once per thread; the following seeds come from a
+ *   splitmix64 sequence started there, so creating a table does not cost a system call.
+ */
+inline uint64_t RandomSeed() {
+    thread_local uint64_t state = (static_cast<uint64_t>(std::random_device()()) << 32 ^ std::random_device()()) ^
+                                  static_cast<uint64_t>(
+                                      std::chrono::steady_clock::now().time_since_epoch().count());
+    uint64_t value = state += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+/*
+ * HashTableIsReseedable:
+ * - True for hash functors with Reseed(uint64_t) and Seed(). HashTable re-seeds them when a chain grows too long, and
+ *   snapshots store their seed.
+ */
+template<typename Hash, typename = void>
+struct HashTableIsReseedable : std::false_type {
+};
+
+template<typename Hash>
+struct HashTableIsReseedable<Hash, std::void_t<decltype(std::declval<Hash &>().Reseed(uint64_t())),
+            decltype(std::declval<const Hash &>().Seed())> > : std::true_type {
+};
+
+/*
+ * SeededHashBase:
+ * - Holds the seed of a SeededHash. A default-constructed hash takes a random seed, so every table hashes differently.
+ */
+class SeededHashBase {
+protected:
+    uint64_t seed;
+
+public:
+    SeededHashBase() : seed(RandomSeed()) {
+    }
+
+    explicit SeededHashBase(const uint64_t seed) : seed(seed) {
+    }
+
+    void Reseed(const uint64_t new_seed) {
+        seed = new_seed;
+    }
+
+    [[nodiscard]] uint64_t Seed() const {
+        return seed;
+    }
+};
+
+/*
+ * SeededHash:
+ * - Keyed hash, the default hash of HashTable. Integers, enums and pointers are hashed by value and strings by their
+ *   bytes with the keyed hash. Any other type is hashed with std::hash and the result is keyed, which spreads the
+ *   keys but can not undo collisions of std::hash itself.
+ * - The string specializations are transparent: std::string, std::string_view and const char * hash the same.
+ */
+template<typename Key, typename = void>
+struct SeededHash : SeededHashBase {
+    using SeededHashBase::SeededHashBase;
+
+    size_t operator()(const Key &key) const {
+        return static_cast<size_t>(seeded_hash::HashInteger(std::hash<Key>()(key), seed));
+    }
+};
+
+template<typename Key>
+struct SeededHash<Key, std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key> || std::is_pointer_v<Key> > >
+        : SeededHashBase {
+    using SeededHashBase::SeededHashBase;
+
+    size_t operator()(const Key key) const {
+        if constexpr (std::is_pointer_v<Key>) {
+            return static_cast<size_t>(seeded_hash::HashInteger(reinterpret_cast<uintptr_t>(key), seed));
+        } else {
+            return static_cast<size_t>(seeded_hash::HashInteger(static_cast<uint64_t>(key), seed));
+        }
+    }
+};
+
+template<>
+struct SeededHash<std::string_view> : SeededHashBase {
+    using is_transparent = void;
+    using SeededHashBase::SeededHashBase;
+
+    size_t operator()(const std::string_view key) const {
+        return static_cast<size_t>(seeded_hash::HashBytes(key.data(), key.size(), seed));
+    }
+};
+
+template<>
+struct SeededHash<std::string> : SeededHash<std::string_view> {
+    using SeededHash<std::string_view>::SeededHash;
+};
+
+
+#endif //SEEDEDHASH_H
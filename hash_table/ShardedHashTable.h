@@ -0,0 +1,245 @@
+#ifndef SHARDEDHASHTABLE_H
+#define SHARDEDHASHTABLE_H
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include "HashMix.h"
+#include "HashTable.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" split into independent shards.
+ *
+ * The ShardedHashTable class holds a power-of-two number of HashTable instances, each with its own lock. A key
+ * always lives in the same shard, chosen by the high bits of its mixed hash, so threads working on different
+ * shards share no state at all.
+ *
+ * Constructors:
+ *  - ShardedHashTable(size_t shard_count = 0, size_t shard_size = 16, float load_factor = 0.75): Initializes a table
+ *    with shard_count shards rounded up to a power of two, or one shard per hardware thread if it is 0. Every shard
+ *    starts with shard_size buckets, at least one.
+ *  - The table is neither copyable nor movable, because the locks are not.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value): Inserts a key-value pair, overwriting the value of an existing key.
+ *  - Value Get(const Key &key): Returns a copy of the value of the key. Throws an exception if the key is not found.
+ *  - bool TryGet(const Key &key, Value &value): Copies the value of the key into value, returns false if not found.
+ *  - void Remove(const Key &key): Removes the key. Throws an exception if the key is not found.
+ *  - void Clear(): Removes all key-value pairs, one shard at a time.
+ *  - bool ContainsKey(const Key &key): Returns true if the table contains the key.
+ *  - void Reserve(size_t count): Makes every shard ready to hold its share of count pairs.
+ *  - [[nodiscard]] bool IsEmpty() const: Returns true if the table is empty.
+ *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs.
+ *  - [[nodiscard]] size_t ShardCount() const: Returns the number of shards.
+ *  - void Show(): Prints every shard.
+ *
+ * Private Methods:
+ *  - Shard &ShardFor(const Key &key): Returns the shard that owns the key.
+ *  - void Publish(Shard &shard): Stores the size of a locked shard into its counter.
+ *
+ * Time Complexity:
+ *  - Insert, Get, TryGet, Remove, ContainsKey: O(1) on average. A resize only blocks the shard that grows.
+ *  - Size, IsEmpty: O(number of shards), without taking any lock.
+ *  - Clear: O(n).
+ *
+ * Features:
+ * - The shard index is taken from the top bits of MixHash(hash), while the shards' own power-of-two bucket indices
+ *   use the low bits, so the keys of one shard still spread over all of its buckets.
+ * - Every shard (lock, table and counter) is aligned to a cache line, so writers of different shards never bounce
+ *   the same line between cores.
+ * - Every shard keeps its own size in a relaxed atomic counter written under the shard lock. Size() sums the
+ *   counters without locking, so it is cheap but only a snapshot while writers are running.
+ * - Get and TryGet copy the value out while the shard mutex is held: once it is released, a Remove or Clear from
+ *   another thread may destroy the node, so no reference to it is handed out.
+ */
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key> >
+class ShardedHashTable {
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        HashTable<Key, Value, Hash, KeyEqual> table;
+        std::atomic<size_t> size{0};
+
+        Shard(const size_t shard_size, const float load_factor): table(shard_size, load_factor) {
+        }
+    };
+
+    // A deque constructs every shard in place from its arguments, which an array of them cannot do, and never has
+    // to move a shard (a mutex cannot be moved).
+    std::deque<Shard> shards;
+    size_t shard_count;
+    unsigned shard_shift;
+    Hash hasher;
+
+    Shard &ShardFor(const Key &key);
+
+    static void Publish(Shard &shard);
+
+public:
+    // --- Constructors ---
+    explicit ShardedHashTable(size_t shard_count = 0, size_t shard_size = 16, float load_factor = 0.75);
+
+    ShardedHashTable(const ShardedHashTable &other) = delete;
+
+    ShardedHashTable(ShardedHashTable &&other) = delete;
+
+    // --- Overload operators ---
+    ShardedHashTable &operator=(const ShardedHashTable &other) = delete;
+
+    ShardedHashTable &operator=(ShardedHashTable &&other) = delete;
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    // --- Get element ---
+    Value Get(const Key &key);
+
+    bool TryGet(const Key &key, Value &value);
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key);
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t ShardCount() const;
+
+    // --- Change size in hash table ---
+    void Reserve(size_t count);
+
+    // --- Show hash table value ---
+    void Show();
+};
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename ShardedHashTable<Key, Value, Hash, KeyEqual>::Shard &
+ShardedHashTable<Key, Value, Hash, KeyEqual>::ShardFor(const Key &key) {
+    if (shard_count == 1) {
+        return shards[0];
+    }
+    return shards[MixHash(hasher(key)) >> shard_shift];
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void ShardedHashTable<Key, Value, Hash, KeyEqual>::Publish(Shard &shard) {
+    shard.size.store(shard.table.Size(), std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+ShardedHashTable<Key, Value, Hash, KeyEqual>::ShardedHashTable(size_t shard_count, const size_t shard_size,
+                                                               const float load_factor) {
+    if (shard_count == 0) {
+        shard_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    this->shard_count = 1;
+    unsigned bits = 0;
+    while (this->shard_count < shard_count) {
+        this->shard_count <<= 1;
+        ++bits;
+    }
+    shard_shift = sizeof(size_t) * 8 - bits;
+    for (size_t i = 0; i < this->shard_count; ++i) {
+        shards.emplace_back(std::max<size_t>(shard_size, 1), load_factor);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void ShardedHashTable<Key, Value, Hash, KeyEqual>::Insert(const Key &key, const Value &value) {
+    Shard &shard = ShardFor(key);
+    std::lock_guard lock(shard.mutex);
+    shard.table.Insert(key, value);
+    Publish(shard);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+Value ShardedHashTable<Key, Value, Hash, KeyEqual>::Get(const Key &key) {
+    Shard &shard = ShardFor(key);
+    std::lock_guard lock(shard.mutex);
+    return shard.table.Get(key);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool ShardedHashTable<Key, Value, Hash, KeyEqual>::TryGet(const Key &key, Value &value) {
+    Shard &shard = ShardFor(key);
+    std::lock_guard lock(shard.mutex);
+    const Value *found = shard.table.Find(key);
+    if (found == nullptr) {
+        return false;
+    }
+    value = *found;
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void ShardedHashTable<Key, Value, Hash, KeyEqual>::Remove(const Key &key) {
+    Shard &shard = ShardFor(key);
+    std::lock_guard lock(shard.mutex);
+    shard.table.Remove(key);
+    Publish(shard);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void ShardedHashTable<Key, Value, Hash, KeyEqual>::Clear() {
+    for (size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard lock(shards[i].mutex);
+        shards[i].table.Clear();
+        Publish(shards[i]);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool ShardedHashTable<Key, Value, Hash, KeyEqual>::ContainsKey(const Key &key) {
+    Shard &shard = ShardFor(key);
+    std::lock_guard lock(shard.mutex);
+    return shard.table.ContainsKey(key);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool ShardedHashTable<Key, Value, Hash, KeyEqual>::IsEmpty() const {
+    return Size() == 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t ShardedHashTable<Key, Value, Hash, KeyEqual>::Size() const {
+    size_t size = 0;
+    for (size_t i = 0; i < shard_count; ++i) {
+        size += shards[i].size.load(std::memory_order_relaxed);
+    }
+    return size;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t ShardedHashTable<Key, Value, Hash, KeyEqual>::ShardCount() const {
+    return shard_count;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void ShardedHashTable<Key, Value, Hash, KeyEqual>::Reserve(const size_t count) {
+    // The mixed hash spreads the keys evenly, a little slack covers the imbalance between shards.
+    const size_t per_shard = count / shard_count + count / shard_count / 8 + 1;
+    for (size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard lock(shards[i].mutex);
+        shards[i].table.Reserve(per_shard);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void ShardedHashTable<Key, Value, Hash, KeyEqual>::Show() {
+    for (size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard lock(shards[i].mutex);
+        std::cout << "Shard number: " << i << std::endl;
+        shards[i].table.Show();
+    }
+}
+
+
+#endif //SHARDEDHASHTABLE_H
@@ -0,0 +1,501 @@
+#ifndef SMALLHASHTABLE_H
+#define SMALLHASHTABLE_H
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "HashTable.h"
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" with inline storage for small sizes.
+ *
+ * The SmallHashTable class provides the same surface as HashTable, but keeps up to N key-value pairs inside the
+ * object itself, in a flat array that is searched linearly. Only when a pair more is inserted does it allocate a
+ * HashTable and move the pairs into it.
+ *
+ * Constructors:
+ *  - SmallHashTable(const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual()): Initializes an empty table.
+ *    Allocates nothing.
+ *  - SmallHashTable(const SmallHashTable &other): Copy constructor, creates a deep copy of another table.
+ *  - SmallHashTable(SmallHashTable &&other): Move constructor. The inline pairs are moved one by one, a
+ *    HashTable is taken over as a whole. noexcept if moving the key, the value and the functors can not throw.
+ *
+ * Destructor:
+ *  - ~SmallHashTable(): Destroys the inline pairs or the HashTable.
+ *
+ * Overloaded Operators:
+ *  - SmallHashTable& operator=(const SmallHashTable &other): Copy assignment operator.
+ *  - SmallHashTable& operator=(SmallHashTable &&other): Move assignment operator, noexcept under the same condition.
+ *
+ * Public Methods:
+ *  - void Insert(const Key &key, const Value &value) / void Insert(Key &&key, Value &&value): Inserts a key-value pair,
+ *    overwriting the value of an existing key. The (N + 1)-th pair moves the table to a HashTable.
+ *  - Value &Get(const Key &key): Retrieves the value associated with the key. Throws an exception if the key is not found.
+ *  - Value *Find(const Key &key): Returns a pointer to the value associated with the key, or nullptr.
+ *  - void Remove(const Key &key): Removes the key. Throws an exception if the key is not found. In inline mode the
+ *    last pair takes the place of the removed one.
+ *  - void Clear(): Removes all key-value pairs and frees the HashTable, going back to inline mode.
+ *  - bool ContainsKey(const Key &key): Returns true if the table contains the key, false otherwise.
+ *  - [[nodiscard]] bool IsEmpty() const: Returns true if the table is empty.
+ *  - [[nodiscard]] size_t Size() const: Returns the number of key-value pairs in the table.
+ *  - [[nodiscard]] bool IsInline() const: Returns true while the pairs are kept inside the object.
+ *  - Iterator Begin() / Iterator End(), begin() / end(): Traversal over all pairs, for range-based for loops:
+ *    for (auto [key, value] : table).
+ *  - void Show() const: Prints the inline pairs or the buckets of the HashTable.
+ *
+ * Private Methods:
+ *  - size_t FindInline(const Key &key) const: Position of the key in the inline array, or N.
+ *  - void Spill(): Moves the inline pairs into a newly allocated HashTable.
+ *  - void DestroyInline(): Destroys the inline pairs.
+ *  - void CopyFrom(const SmallHashTable &other) / void MoveFrom(SmallHashTable &other): Shared bodies of the copy and
+ *    move operations.
+ *  - void InsertImpl(K &&key, V &&value): Shared body of both Insert overloads.
+ *
+ * Time Complexity:
+ *  - Insert, Get, Find, Remove, ContainsKey: O(N) in inline mode, without hashing the key; O(1) on average after that.
+ *  - Clear: O(n).
+ *
+ * Features:
+ * - A default-constructed table allocates nothing, and a table that never holds more than N pairs never allocates at
+ *   all. That suits many tiny maps, e.g. per-object attributes, where a HashTable would allocate its bucket array
+ *   for every object.
+ * - For a few pairs a linear scan of one contiguous array is faster than hashing the key and following a chain.
+ * - Once moved to a HashTable the table stays there until Clear, so a size oscillating around N does not move the
+ *   pairs back and forth.
+ */
+template<typename Key, typename Value, size_t N = 8, typename Hash = SeededHash<Key>,
+    typename KeyEqual = std::equal_to<Key> >
+class SmallHashTable {
+    static_assert(N > 0, "SmallHashTable needs room for at least one inline pair");
+
+    using Table = HashTable<Key, Value, Hash, KeyEqual>;
+
+    struct Pair {
+        Key key;
+        Value value;
+
+        template<typename K, typename V>
+        Pair(K &&key, V &&value) : key(std::forward<K>(key)), value(std::forward<V>(value)) {
+        }
+    };
+
+    // Moving a table moves every inline pair and copies or moves the functors, so it can only promise not to throw
+    // if none of them can.
+    static constexpr bool kNothrowMove = std::is_nothrow_move_constructible_v<Pair> &&
+                                         std::is_nothrow_copy_constructible_v<Hash> &&
+                                         std::is_nothrow_copy_constructible_v<KeyEqual> &&
+                                         std::is_nothrow_move_assignable_v<Hash> &&
+                                         std::is_nothrow_move_assignable_v<KeyEqual>;
+
+    alignas(Pair) unsigned char storage[N][sizeof(Pair)];
+    size_t inline_count;
+    std::unique_ptr<Table> table;
+    Hash hasher;
+    KeyEqual key_equal;
+
+    Pair &At(size_t index);
+
+    const Pair &At(size_t index) const;
+
+    [[nodiscard]] size_t FindInline(const Key &key) const;
+
+    void Spill();
+
+    void DestroyInline();
+
+    void CopyFrom(const SmallHashTable &other);
+
+    void MoveFrom(SmallHashTable &other);
+
+    template<typename K, typename V>
+    void InsertImpl(K &&key, V &&value);
+
+    /*
+    * Iterator class:
+    * - Iterator: Forward traversal over the inline pairs, or over the HashTable once the table has left inline mode.
+    *   - bool operator!=(const Iterator &other) const: Checks if two iterators point to different pairs.
+    *   - Iterator &operator++(): Advances the iterator to the next key-value pair.
+    *   - Iterator operator++(int): Advances the iterator and returns a copy of the previous iterator.
+    *   - Entry operator*() const: Returns the key and a reference to the value of the current pair.
+    *   - EntryPointer operator->() const: Provides access to the key and the value as it->key and it->value.
+    *
+    */
+public:
+    using Entry = typename Table::Entry;
+
+    class Iterator {
+        SmallHashTable *owner;
+        size_t index;
+        typename Table::Iterator table_iterator;
+
+    public:
+        struct EntryPointer {
+            Entry entry;
+
+            const Entry *operator->() const {
+                return &entry;
+            }
+        };
+
+        Iterator(SmallHashTable *owner, size_t index, typename Table::Iterator table_iterator);
+
+        bool operator!=(const Iterator &other) const;
+
+        bool operator==(const Iterator &other) const;
+
+        Iterator &operator++();
+
+        Iterator operator++(int);
+
+        Entry operator*() const;
+
+        EntryPointer operator->() const;
+    };
+
+    // --- Constructors ---
+    explicit SmallHashTable(const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual());
+
+    SmallHashTable(const SmallHashTable &other);
+
+    SmallHashTable(SmallHashTable &&other) noexcept(kNothrowMove);
+
+    // --- Overload operators ---
+    SmallHashTable &operator=(const SmallHashTable &other);
+
+    SmallHashTable &operator=(SmallHashTable &&other) noexcept(kNothrowMove);
+
+    // --- Destructors ---
+    ~SmallHashTable();
+
+    // --- Add element ---
+    void Insert(const Key &key, const Value &value);
+
+    void Insert(Key &&key, Value &&value);
+
+    // --- Get element ---
+    Value &Get(const Key &key);
+
+    Value *Find(const Key &key);
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key);
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] bool IsInline() const;
+
+    // --- Traversal ---
+    Iterator Begin();
+
+    Iterator End();
+
+    Iterator begin();
+
+    Iterator end();
+
+    // --- Show hash table value ---
+    void Show() const;
+};
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Pair &
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::At(const size_t index) {
+    return *std::launder(reinterpret_cast<Pair *>(storage[index]));
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+const typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Pair &
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::At(const size_t index) const {
+    return *std::launder(reinterpret_cast<const Pair *>(storage[index]));
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+size_t SmallHashTable<Key, Value, N, Hash, KeyEqual>::FindInline(const Key &key) const {
+    for (size_t i = 0; i < inline_count; ++i) {
+        if (key_equal(At(i).key, key)) {
+            return i;
+        }
+    }
+    return N;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::Spill() {
+    // Room for twice the inline pairs below the default load factor of 0.75.
+    size_t table_size = 16;
+    while (table_size * 3 < N * 2 * 4) {
+        table_size *= 2;
+    }
+    auto new_table = std::make_unique<Table>(table_size, 0.75f, hasher, key_equal);
+    for (size_t i = 0; i < inline_count; ++i) {
+        new_table->Insert(std::move(At(i).key), std::move(At(i).value));
+    }
+    DestroyInline();
+    table = std::move(new_table);
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::DestroyInline() {
+    for (size_t i = 0; i < inline_count; ++i) {
+        At(i).~Pair();
+    }
+    inline_count = 0;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::CopyFrom(const SmallHashTable &other) {
+    hasher = other.hasher;
+    key_equal = other.key_equal;
+    if (other.table != nullptr) {
+        table = std::make_unique<Table>(*other.table);
+        return;
+    }
+    for (; inline_count < other.inline_count; ++inline_count) {
+        new(storage[inline_count]) Pair(other.At(inline_count));
+    }
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::MoveFrom(SmallHashTable &other) {
+    hasher = std::move(other.hasher);
+    key_equal = std::move(other.key_equal);
+    table = std::move(other.table);
+    for (; inline_count < other.inline_count; ++inline_count) {
+        new(storage[inline_count]) Pair(std::move(other.At(inline_count)));
+    }
+    other.DestroyInline();
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+template<typename K, typename V>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::InsertImpl(K &&key, V &&value) {
+    if (table == nullptr) {
+        if (const size_t index = FindInline(key); index != N) {
+            At(index).value = std::forward<V>(value);
+            return;
+        }
+        if (inline_count < N) {
+            new(storage[inline_count]) Pair(std::forward<K>(key), std::forward<V>(value));
+            ++inline_count;
+            return;
+        }
+        Spill();
+    }
+    table->InsertOrAssign(std::forward<K>(key), std::forward<V>(value));
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::SmallHashTable(const Hash &hash, const KeyEqual &equal)
+    : inline_count(0), hasher(hash), key_equal(equal) {
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::SmallHashTable(const SmallHashTable &other)
+    : inline_count(0), hasher(other.hasher), key_equal(other.key_equal) {
+    CopyFrom(other);
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::SmallHashTable(SmallHashTable &&other) noexcept(kNothrowMove)
+    : inline_count(0), hasher(other.hasher), key_equal(other.key_equal) {
+    MoveFrom(other);
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+SmallHashTable<Key, Value, N, Hash, KeyEqual> &
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::operator=(const SmallHashTable &other) {
+    if (this != &other) {
+        Clear();
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+SmallHashTable<Key, Value, N, Hash, KeyEqual> &
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::operator=(SmallHashTable &&other) noexcept(kNothrowMove) {
+    if (this != &other) {
+        Clear();
+        MoveFrom(other);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::~SmallHashTable() {
+    DestroyInline();
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::Insert(const Key &key, const Value &value) {
+    InsertImpl(key, value);
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::Insert(Key &&key, Value &&value) {
+    InsertImpl(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+Value &SmallHashTable<Key, Value, N, Hash, KeyEqual>::Get(const Key &key) {
+    Value *value = Find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+Value *SmallHashTable<Key, Value, N, Hash, KeyEqual>::Find(const Key &key) {
+    if (table != nullptr) {
+        return table->Find(key);
+    }
+    const size_t index = FindInline(key);
+    return index == N ? nullptr : &At(index).value;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::Remove(const Key &key) {
+    if (table != nullptr) {
+        table->Remove(key);
+        return;
+    }
+    const size_t index = FindInline(key);
+    if (index == N) {
+        throw std::out_of_range("No such key exists!\n");
+    }
+    if (index != inline_count - 1) {
+        At(index).key = std::move(At(inline_count - 1).key);
+        At(index).value = std::move(At(inline_count - 1).value);
+    }
+    At(--inline_count).~Pair();
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::Clear() {
+    DestroyInline();
+    table.reset();
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+bool SmallHashTable<Key, Value, N, Hash, KeyEqual>::ContainsKey(const Key &key) {
+    return Find(key) != nullptr;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+bool SmallHashTable<Key, Value, N, Hash, KeyEqual>::IsEmpty() const {
+    return Size() == 0;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+size_t SmallHashTable<Key, Value, N, Hash, KeyEqual>::Size() const {
+    return table != nullptr ? table->Size() : inline_count;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+bool SmallHashTable<Key, Value, N, Hash, KeyEqual>::IsInline() const {
+    return table == nullptr;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator::Iterator(SmallHashTable *owner, const size_t index,
+                                                                  typename Table::Iterator table_iterator)
+    : owner(owner), index(index), table_iterator(table_iterator) {
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+bool SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator::operator!=(const Iterator &other) const {
+    return index != other.index || table_iterator != other.table_iterator;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+bool SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator::operator==(const Iterator &other) const {
+    return !(*this != other);
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator &
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator::operator++() {
+    if (owner->table != nullptr) {
+        ++table_iterator;
+    } else {
+        ++index;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator::operator++(int) {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Entry
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator::operator*() const {
+    if (owner->table != nullptr) {
+        return *table_iterator;
+    }
+    return {owner->At(index).key, owner->At(index).value};
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator::EntryPointer
+SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator::operator->() const {
+    return {**this};
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator SmallHashTable<Key, Value, N, Hash, KeyEqual>::Begin() {
+    // In inline mode the table iterator is always the end iterator of HashTable, and in table mode the index is 0.
+    if (table != nullptr) {
+        return Iterator(this, 0, table->Begin());
+    }
+    return Iterator(this, 0, typename Table::Iterator(nullptr, nullptr, nullptr));
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator SmallHashTable<Key, Value, N, Hash, KeyEqual>::End() {
+    if (table != nullptr) {
+        return Iterator(this, 0, table->End());
+    }
+    return Iterator(this, inline_count, typename Table::Iterator(nullptr, nullptr, nullptr));
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator SmallHashTable<Key, Value, N, Hash, KeyEqual>::begin() {
+    return Begin();
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+typename SmallHashTable<Key, Value, N, Hash, KeyEqual>::Iterator SmallHashTable<Key, Value, N, Hash, KeyEqual>::end() {
+    return End();
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+void SmallHashTable<Key, Value, N, Hash, KeyEqual>::Show() const {
+    if (table != nullptr) {
+        table->Show();
+        return;
+    }
+    for (size_t i = 0; i < inline_count; ++i) {
+        std::cout << "[" << At(i).key << ", " << At(i).value << "] -> ";
+    }
+    std::cout << "nullptr" << std::endl;
+}
+
+
+#endif //SMALLHASHTABLE_H
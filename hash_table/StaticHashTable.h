@@ -0,0 +1,254 @@
+#ifndef STATICHASHTABLE_H
+#define STATICHASHTABLE_H
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "HashMix.h"
+
+/*
+ * StaticHash:
+ * - Seeded hash usable in constant expressions, the default hash of StaticHashTable. The integral specialization
+ *   mixes the key with the seed, the std::string_view one runs FNV-1a from a seed-dependent basis.
+ */
+template<typename Key, typename = void>
+struct StaticHash;
+
+template<typename Key>
+struct StaticHash<Key, std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key> > > {
+    constexpr uint64_t operator()(const Key key, const uint64_t seed) const {
+        return MixHash(static_cast<uint64_t>(key) ^ MixHash(seed + 0x9e3779b97f4a7c15ULL));
+    }
+};
+
+template<>
+struct StaticHash<std::string_view> {
+    constexpr uint64_t operator()(const std::string_view key, const uint64_t seed) const {
+        uint64_t hash = 0xcbf29ce484222325ULL ^ MixHash(seed);
+        for (const char symbol: key) {
+            hash = (hash ^ static_cast<unsigned char>(symbol)) * 0x100000001b3ULL;
+        }
+        return MixHash(hash);
+    }
+};
+
+/**
+ * Implementation of the Abstract Data Type (ADT) "Hash Table" for a key set fixed at compile time.
+ *
+ * The StaticHashTable class is built by a constexpr constructor from N distinct key-value pairs and finds a
+ * collision-free (perfect) hash function for them with the hash-and-displace method (CHD). Declared constexpr, the
+ * whole table is computed by the compiler and placed in read-only memory.
+ *
+ * Constructors:
+ *  - constexpr StaticHashTable(const std::pair<Key, Value> (&entries)[N]): Builds the table. Throws
+ *    std::invalid_argument for duplicate keys, which makes a constexpr construction fail to compile.
+ *  - MakeStaticHashTable(const std::pair<Key, Value> (&entries)[N]): Same, deducing Key, Value and N:
+ *    constexpr auto opcodes = MakeStaticHashTable<std::string_view, int>({{"add", 0}, {"sub", 1}});
+ *
+ * Public Methods:
+ *  - constexpr const Value *Find(const Key &key) const: Returns a pointer to the value of the key, or nullptr.
+ *  - constexpr const Value &Get(const Key &key) const: Same as Find, but throws an exception if the key is not found.
+ *  - constexpr bool ContainsKey(const Key &key) const: Returns true if the table contains the key.
+ *  - [[nodiscard]] constexpr size_t Size() const: Returns N.
+ *  - [[nodiscard]] constexpr size_t Capacity() const: Returns the number of slots, N rounded up to a power of two.
+ *
+ * Private Methods:
+ *  - constexpr size_t BucketOf(const Key &key) const: First-level bucket of a key.
+ *  - constexpr size_t SlotOf(const Key &key) const: Slot of a key, from the displacement of its bucket.
+ *
+ * Time Complexity:
+ *  - Construction: O(N) expected number of hash evaluations per bucket, done once by the compiler.
+ *  - Find, Get, ContainsKey: O(1) - two hash evaluations and exactly one key comparison, no chains and no probing.
+ *
+ * Features:
+ * - The keys are first split into buckets by StaticHash(key, 0). The buckets are placed from the largest to the
+ *   smallest: for every bucket the builder searches for a seed d under which StaticHash(key, d) sends all of its keys
+ *   to distinct free slots, and stores d as the displacement of the bucket. A bucket of a single key simply takes
+ *   the next free slot, which is stored directly as a negative displacement.
+ * - Both levels use a mask instead of %, because the numbers of buckets and slots are powers of two.
+ * - Hash and KeyEqual must be usable in constant expressions; StaticHash covers integers, enums and std::string_view.
+ */
+template<typename Key, typename Value, size_t N, typename Hash = StaticHash<Key>, typename KeyEqual = std::equal_to<Key> >
+class StaticHashTable {
+    static constexpr size_t RoundUp(size_t count) {
+        size_t power = 1;
+        while (power < count) {
+            power *= 2;
+        }
+        return power;
+    }
+
+    static constexpr size_t kSlots = RoundUp(N);
+    // A bucket that needs more seeds than this has keys the hash can not separate.
+    static constexpr uint64_t kMaxSeed = 1 << 20;
+
+    struct Slot {
+        Key key{};
+        Value value{};
+        bool used = false;
+    };
+
+    std::array<int64_t, kSlots> displacements{};
+    std::array<Slot, kSlots> slots{};
+    Hash hasher{};
+    KeyEqual key_equal{};
+
+    [[nodiscard]] constexpr size_t BucketOf(const Key &key) const;
+
+    [[nodiscard]] constexpr size_t SlotOf(const Key &key) const;
+
+public:
+    // --- Constructors ---
+    constexpr explicit StaticHashTable(const std::pair<Key, Value> (&entries)[N]);
+
+    // --- Get element ---
+    constexpr const Value *Find(const Key &key) const;
+
+    constexpr const Value &Get(const Key &key) const;
+
+    // --- Find element ---
+    constexpr bool ContainsKey(const Key &key) const;
+
+    // --- Get size ---
+    [[nodiscard]] constexpr size_t Size() const;
+
+    [[nodiscard]] constexpr size_t Capacity() const;
+};
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+constexpr size_t StaticHashTable<Key, Value, N, Hash, KeyEqual>::BucketOf(const Key &key) const {
+    return static_cast<size_t>(hasher(key, 0)) & (kSlots - 1);
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+constexpr size_t StaticHashTable<Key, Value, N, Hash, KeyEqual>::SlotOf(const Key &key) const {
+    const int64_t displacement = displacements[BucketOf(key)];
+    if (displacement < 0) {
+        return static_cast<size_t>(-displacement - 1);
+    }
+    return static_cast<size_t>(hasher(key, static_cast<uint64_t>(displacement))) & (kSlots - 1);
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+constexpr StaticHashTable<Key, Value, N, Hash, KeyEqual>::StaticHashTable(const std::pair<Key, Value> (&entries)[N]) {
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = i + 1; j < N; ++j) {
+            if (key_equal(entries[i].first, entries[j].first)) {
+                throw std::invalid_argument("Duplicate key in a static hash table!\n");
+            }
+        }
+    }
+    // Group the keys by bucket with a counting sort: the keys of bucket b are order[starts[b]] .. order[starts[b + 1]).
+    std::array<size_t, kSlots + 1> starts{};
+    std::array<size_t, N> order{};
+    for (size_t i = 0; i < N; ++i) {
+        ++starts[BucketOf(entries[i].first) + 1];
+    }
+    for (size_t b = 0; b < kSlots; ++b) {
+        starts[b + 1] += starts[b];
+    }
+    std::array<size_t, kSlots> next{};
+    for (size_t b = 0; b < kSlots; ++b) {
+        next[b] = starts[b];
+    }
+    for (size_t i = 0; i < N; ++i) {
+        order[next[BucketOf(entries[i].first)]++] = i;
+    }
+    // Place the largest buckets first, while most slots are still free.
+    std::array<size_t, kSlots> buckets{};
+    for (size_t b = 0; b < kSlots; ++b) {
+        size_t position = b;
+        while (position > 0 &&
+               starts[buckets[position - 1] + 1] - starts[buckets[position - 1]] < starts[b + 1] - starts[b]) {
+            buckets[position] = buckets[position - 1];
+            --position;
+        }
+        buckets[position] = b;
+    }
+    size_t free_slot = 0;
+    for (size_t b: buckets) {
+        const size_t first = starts[b];
+        const size_t count = starts[b + 1] - first;
+        if (count == 0) {
+            break;
+        }
+        if (count == 1) {
+            while (slots[free_slot].used) {
+                ++free_slot;
+            }
+            displacements[b] = -static_cast<int64_t>(free_slot) - 1;
+            slots[free_slot].key = entries[order[first]].first;
+            slots[free_slot].value = entries[order[first]].second;
+            slots[free_slot].used = true;
+            continue;
+        }
+        for (uint64_t seed = 1;; ++seed) {
+            if (seed == kMaxSeed) {
+                throw std::invalid_argument("No perfect hash found for the static hash table keys!\n");
+            }
+            std::array<size_t, N> placed{};
+            bool fits = true;
+            for (size_t i = 0; i < count && fits; ++i) {
+                placed[i] = static_cast<size_t>(hasher(entries[order[first + i]].first, seed)) & (kSlots - 1);
+                fits = !slots[placed[i]].used;
+                for (size_t j = 0; j < i && fits; ++j) {
+                    fits = placed[j] != placed[i];
+                }
+            }
+            if (fits) {
+                displacements[b] = static_cast<int64_t>(seed);
+                for (size_t i = 0; i < count; ++i) {
+                    slots[placed[i]].key = entries[order[first + i]].first;
+                    slots[placed[i]].value = entries[order[first + i]].second;
+                    slots[placed[i]].used = true;
+                }
+                break;
+            }
+        }
+    }
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+constexpr const Value *StaticHashTable<Key, Value, N, Hash, KeyEqual>::Find(const Key &key) const {
+    const Slot &slot = slots[SlotOf(key)];
+    if (slot.used && key_equal(slot.key, key)) {
+        return &slot.value;
+    }
+    return nullptr;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+constexpr const Value &StaticHashTable<Key, Value, N, Hash, KeyEqual>::Get(const Key &key) const {
+    const Value *value = Find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+constexpr bool StaticHashTable<Key, Value, N, Hash, KeyEqual>::ContainsKey(const Key &key) const {
+    return Find(key) != nullptr;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+constexpr size_t StaticHashTable<Key, Value, N, Hash, KeyEqual>::Size() const {
+    return N;
+}
+
+template<typename Key, typename Value, size_t N, typename Hash, typename KeyEqual>
+constexpr size_t StaticHashTable<Key, Value, N, Hash, KeyEqual>::Capacity() const {
+    return kSlots;
+}
+
+template<typename Key, typename Value, size_t N>
+constexpr StaticHashTable<Key, Value, N> MakeStaticHashTable(const std::pair<Key, Value> (&entries)[N]) {
+    return StaticHashTable<Key, Value, N>(entries);
+}
+
+
+#endif //STATICHASHTABLE_H
@@ -0,0 +1,451 @@
+#ifndef LRUCACHE_H
+#define LRUCACHE_H
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "../hash_table/HashTable.h"
+#include "../hash_table/NodePool.h"
+
+/*
+ * Replacement policy of LruCache:
+ * - kLru: Every hit moves the entry to the front of the recency list, the entry at the back is evicted.
+ * - kClock: A hit only sets the referenced bit of the entry. The clock hand sweeps the entries, clearing the bits,
+ *   and evicts the first entry whose bit is already clear.
+ */
+enum class CachePolicy {
+    kLru,
+    kClock
+};
+
+/**
+ * Implementation of the Abstract Data Type (ADT) "LRU Cache".
+ *
+ * The LruCache class is a bounded key-value store: once the total weight of its entries would exceed the capacity,
+ * the least recently used entries are evicted. The entries are found through a HashTable and kept in a doubly linked
+ * recency list whose nodes live in a NodePool.
+ *
+ * Constructors:
+ *  - LruCache(size_t capacity, CachePolicy policy = CachePolicy::kLru, Weigher weigher = nullptr): Initializes an
+ *    empty cache. Without a weigher every entry weighs 1 and the capacity is a number of entries; with a weigher
+ *    (e.g. returning the size of the value in bytes) the capacity bounds the sum of the weights.
+ *  - LruCache(LruCache &&other) noexcept: Move constructor, transfers ownership of the entries.
+ *  - The cache is not copyable: the eviction callback may own resources tied to the entries.
+ *
+ * Destructor:
+ *  - ~LruCache(): Destroys all entries without calling the eviction callback.
+ *
+ * Overloaded Operators:
+ *  - LruCache& operator=(LruCache &&other) noexcept: Move assignment operator.
+ *
+ * Public Methods:
+ *  - bool Put(const Key &key, const Value &value) / bool Put(Key &&key, Value &&value): Inserts or overwrites the
+ *    entry and marks it as used, evicting other entries if needed. Returns false, without storing anything, if the
+ *    entry alone is heavier than the capacity.
+ *  - Value *Find(const Key &key): Returns a pointer to the cached value and marks the entry as used, or nullptr.
+ *  - Value &Get(const Key &key): Same as Find, but throws an exception if the key is not cached.
+ *  - bool ContainsKey(const Key &key): Returns true if the key is cached. Does not mark the entry as used.
+ *  - void Remove(const Key &key): Removes the entry without calling the eviction callback. Throws if it is not cached.
+ *  - void Clear(): Removes all entries without calling the eviction callback.
+ *  - void SetCapacity(size_t capacity): Changes the capacity, evicting entries if the cache no longer fits.
+ *  - void SetEvictionCallback(EvictionCallback callback): Sets the function called with every evicted entry.
+ *  - [[nodiscard]] bool IsEmpty() const, [[nodiscard]] size_t Size() const: Number of entries.
+ *  - [[nodiscard]] size_t Weight() const, [[nodiscard]] size_t Capacity() const: Total weight and its bound.
+ *  - [[nodiscard]] CachePolicy Policy() const: Returns the replacement policy.
+ *  - void Show() const: Prints the entries from the most to the least recently inserted or used (LRU).
+ *
+ * Private Methods:
+ *  - void LinkFront(Node *node) / void LinkAfter(Node *position, Node *node) / void Unlink(Node *node): Maintain the
+ *    recency list.
+ *  - void Touch(Node *node): Records a hit according to the policy.
+ *  - Node *NextVictim(const Node *keep): Picks the entry to evict, never the one being updated.
+ *  - void EvictUntilFits(size_t incoming, const Node *keep): Evicts entries until incoming more weight fits.
+ *  - bool PutImpl(K &&key, V &&value): Shared body of both Put overloads.
+ *
+ * Time Complexity:
+ *  - Put, Find, Get, ContainsKey, Remove: O(1) on average, plus O(1) per evicted entry. A CLOCK eviction is
+ *    amortized O(1): every sweep step clears a bit that a hit had to set.
+ *  - Clear: O(n).
+ *
+ * Features:
+ * - In CLOCK mode a hit writes one flag and does not touch the list, so read-mostly workloads do not pay for moving
+ *   nodes around and keep the list cache-friendly. New entries are placed right behind the hand, so they are
+ *   the last to be looked at by the next sweep.
+ * - Evicted entries are handed to the eviction callback before they are destroyed, e.g. to write them back.
+ */
+template<typename Key, typename Value, typename Hash = SeededHash<Key>, typename KeyEqual = std::equal_to<Key> >
+class LruCache {
+public:
+    using Weigher = std::function<size_t(const Key &, const Value &)>;
+    using EvictionCallback = std::function<void(const Key &, Value &)>;
+
+private:
+    struct Node {
+        Key key;
+        Value value;
+        size_t weight;
+        Node *previous = nullptr;
+        Node *next = nullptr;
+        bool referenced = false;
+
+        template<typename K, typename V>
+        Node(K &&key, V &&value, size_t weight): key(std::forward<K>(key)), value(std::forward<V>(value)),
+                                                 weight(weight) {
+        }
+    };
+
+    HashTable<Key, Node *, Hash, KeyEqual> index;
+    NodePool<Node> pool;
+    Node *head = nullptr;
+    Node *tail = nullptr;
+    Node *hand = nullptr;
+    size_t capacity;
+    size_t total_weight = 0;
+    CachePolicy policy;
+    Weigher weigher;
+    EvictionCallback on_evict;
+
+    void LinkFront(Node *node);
+
+    void LinkAfter(Node *position, Node *node);
+
+    void Unlink(Node *node);
+
+    void Touch(Node *node);
+
+    Node *NextVictim(const Node *keep);
+
+    void EvictUntilFits(size_t incoming, const Node *keep);
+
+    void DestroyNodes();
+
+    template<typename K, typename V>
+    bool PutImpl(K &&key, V &&value);
+
+public:
+    // --- Constructors ---
+    explicit LruCache(size_t capacity, CachePolicy policy = CachePolicy::kLru, Weigher weigher = nullptr);
+
+    LruCache(const LruCache &other) = delete;
+
+    LruCache(LruCache &&other) noexcept;
+
+    // --- Destructor ---
+    ~LruCache();
+
+    // --- Overload operators ---
+    LruCache &operator=(const LruCache &other) = delete;
+
+    LruCache &operator=(LruCache &&other) noexcept;
+
+    // --- Add element ---
+    bool Put(const Key &key, const Value &value);
+
+    bool Put(Key &&key, Value &&value);
+
+    // --- Get element ---
+    Value *Find(const Key &key);
+
+    Value &Get(const Key &key);
+
+    // --- Remove element ---
+    void Remove(const Key &key);
+
+    void Clear();
+
+    // --- Find element ---
+    bool ContainsKey(const Key &key);
+
+    // --- Check is empty ---
+    [[nodiscard]] bool IsEmpty() const;
+
+    // --- Get size ---
+    [[nodiscard]] size_t Size() const;
+
+    [[nodiscard]] size_t Weight() const;
+
+    [[nodiscard]] size_t Capacity() const;
+
+    // --- Configuration ---
+    void SetCapacity(size_t capacity);
+
+    void SetEvictionCallback(EvictionCallback callback);
+
+    [[nodiscard]] CachePolicy Policy() const;
+
+    // --- Show cache ---
+    void Show() const;
+};
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::LinkFront(Node *node) {
+    node->previous = nullptr;
+    node->next = head;
+    if (head != nullptr) {
+        head->previous = node;
+    } else {
+        tail = node;
+    }
+    head = node;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::LinkAfter(Node *position, Node *node) {
+    node->previous = position;
+    node->next = position->next;
+    if (position->next != nullptr) {
+        position->next->previous = node;
+    } else {
+        tail = node;
+    }
+    position->next = node;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::Unlink(Node *node) {
+    if (hand == node) {
+        hand = node->previous != nullptr ? node->previous : (node->next != nullptr ? tail : nullptr);
+    }
+    if (node->previous != nullptr) {
+        node->previous->next = node->next;
+    } else {
+        head = node->next;
+    }
+    if (node->next != nullptr) {
+        node->next->previous = node->previous;
+    } else {
+        tail = node->previous;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::Touch(Node *node) {
+    if (policy == CachePolicy::kClock) {
+        node->referenced = true;
+    } else if (node != head) {
+        Unlink(node);
+        LinkFront(node);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename LruCache<Key, Value, Hash, KeyEqual>::Node *
+LruCache<Key, Value, Hash, KeyEqual>::NextVictim(const Node *keep) {
+    if (policy == CachePolicy::kLru) {
+        return tail != keep ? tail : tail->previous;
+    }
+    // The hand moves from the tail towards the head and wraps around.
+    while (true) {
+        if (hand == nullptr) {
+            hand = tail;
+        }
+        Node *current = hand;
+        hand = current->previous;
+        if (current == keep) {
+            continue;
+        }
+        if (!current->referenced) {
+            return current;
+        }
+        current->referenced = false;
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::EvictUntilFits(const size_t incoming, const Node *keep) {
+    while (total_weight + incoming > capacity && head != nullptr && (head != keep || head != tail)) {
+        Node *victim = NextVictim(keep);
+        Unlink(victim);
+        index.Remove(victim->key);
+        total_weight -= victim->weight;
+        if (on_evict) {
+            on_evict(victim->key, victim->value);
+        }
+        pool.Destroy(victim);
+    }
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::DestroyNodes() {
+    while (head != nullptr) {
+        Node *next = head->next;
+        pool.Destroy(head);
+        head = next;
+    }
+    tail = hand = nullptr;
+    total_weight = 0;
+    pool.Release();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K, typename V>
+bool LruCache<Key, Value, Hash, KeyEqual>::PutImpl(K &&key, V &&value) {
+    const size_t weight = weigher ? weigher(key, value) : 1;
+    if (weight > capacity) {
+        return false;
+    }
+    if (Node **found = index.Find(key); found != nullptr) {
+        Node *node = *found;
+        node->value = std::forward<V>(value);
+        total_weight = total_weight - node->weight + weight;
+        node->weight = weight;
+        Touch(node);
+        EvictUntilFits(0, node);
+        return true;
+    }
+    EvictUntilFits(weight, nullptr);
+    Node *node = pool.Create(std::forward<K>(key), std::forward<V>(value), weight);
+    try {
+        index.Insert(node->key, node);
+    } catch (...) {
+        pool.Destroy(node);
+        throw;
+    }
+    if (policy == CachePolicy::kClock && hand != nullptr) {
+        LinkAfter(hand, node);
+    } else {
+        LinkFront(node);
+    }
+    total_weight += weight;
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LruCache<Key, Value, Hash, KeyEqual>::LruCache(const size_t capacity, const CachePolicy policy, Weigher weigher)
+    : capacity(capacity), policy(policy), weigher(std::move(weigher)) {
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LruCache<Key, Value, Hash, KeyEqual>::LruCache(LruCache &&other) noexcept
+    : index(std::move(other.index)), pool(std::move(other.pool)), head(other.head), tail(other.tail),
+      hand(other.hand), capacity(other.capacity), total_weight(other.total_weight), policy(other.policy),
+      weigher(std::move(other.weigher)), on_evict(std::move(other.on_evict)) {
+    other.head = other.tail = other.hand = nullptr;
+    other.total_weight = 0;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LruCache<Key, Value, Hash, KeyEqual>::~LruCache() {
+    DestroyNodes();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+LruCache<Key, Value, Hash, KeyEqual> &LruCache<Key, Value, Hash, KeyEqual>::operator=(LruCache &&other) noexcept {
+    if (this != &other) {
+        DestroyNodes();
+        index = std::move(other.index);
+        pool = std::move(other.pool);
+        head = other.head;
+        tail = other.tail;
+        hand = other.hand;
+        capacity = other.capacity;
+        total_weight = other.total_weight;
+        policy = other.policy;
+        weigher = std::move(other.weigher);
+        on_evict = std::move(other.on_evict);
+
+        other.head = other.tail = other.hand = nullptr;
+        other.total_weight = 0;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LruCache<Key, Value, Hash, KeyEqual>::Put(const Key &key, const Value &value) {
+    return PutImpl(key, value);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LruCache<Key, Value, Hash, KeyEqual>::Put(Key &&key, Value &&value) {
+    return PutImpl(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+Value *LruCache<Key, Value, Hash, KeyEqual>::Find(const Key &key) {
+    Node **found = index.Find(key);
+    if (found == nullptr) {
+        return nullptr;
+    }
+    Touch(*found);
+    return &(*found)->value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+Value &LruCache<Key, Value, Hash, KeyEqual>::Get(const Key &key) {
+    Value *value = Find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Incorrect key index!\n");
+    }
+    return *value;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::Remove(const Key &key) {
+    Node **found = index.Find(key);
+    if (found == nullptr) {
+        throw std::out_of_range("No such key exists!\n");
+    }
+    Node *node = *found;
+    Unlink(node);
+    index.Remove(key);
+    total_weight -= node->weight;
+    pool.Destroy(node);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::Clear() {
+    DestroyNodes();
+    index.Clear();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LruCache<Key, Value, Hash, KeyEqual>::ContainsKey(const Key &key) {
+    return index.ContainsKey(key);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+bool LruCache<Key, Value, Hash, KeyEqual>::IsEmpty() const {
+    return head == nullptr;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LruCache<Key, Value, Hash, KeyEqual>::Size() const {
+    return index.Size();
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LruCache<Key, Value, Hash, KeyEqual>::Weight() const {
+    return total_weight;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t LruCache<Key, Value, Hash, KeyEqual>::Capacity() const {
+    return capacity;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::SetCapacity(const size_t capacity) {
+    this->capacity = capacity;
+    EvictUntilFits(0, nullptr);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::SetEvictionCallback(EvictionCallback callback) {
+    on_evict = std::move(callback);
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+CachePolicy LruCache<Key, Value, Hash, KeyEqual>::Policy() const {
+    return policy;
+}
+
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void LruCache<Key, Value, Hash, KeyEqual>::Show() const {
+    for (const Node *current = head; current != nullptr; current = current->next) {
+        std::cout << current->key << " -> " << current->value << std::endl;
+    }
+}
+
+
+#endif //LRUCACHE_H
@@ -6,6 +6,18 @@
 #include "stack/Stack.h"
 #include "binary_tree/BinaryTree.h"
 #include "hash_table/HashTable.h"
+#include "hash_table/FlatHashTable.h"
+#include "hash_table/ConcurrentHashTable.h"
+#include "hash_table/RobinHoodHashTable.h"
+#include "hash_table/ShardedHashTable.h"
+#include "hash_table/LockFreeReadHashTable.h"
+#include "hash_table/StaticHashTable.h"
+#include "hash_table/CuckooHashTable.h"
+#include "hash_table/LinkedHashTable.h"
+#include "hash_table/SmallHashTable.h"
+#include "hash_table/ExpiringHashTable.h"
+#include "hash_table/PersistentHashTable.h"
+#include "lru_cache/LruCache.h"
 
 
 int main() {